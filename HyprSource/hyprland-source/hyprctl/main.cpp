@@ -9,6 +9,7 @@
 #include <sys/types.h>
 #include <sys/un.h>
 #include <unistd.h>
+#include <errno.h>
 #include <ranges>
 #include <algorithm>
 
@@ -44,6 +45,13 @@ commands:
     plugin
     notify
     globalshortcuts
+    rulecache
+    gputimes
+    frametimes
+    configbench
+    jsonbench
+    layoutbench
+    trace
 
 flags:
     -j -> output in JSON
@@ -97,21 +105,16 @@ void              request(std::string arg, int minArgs = 0) {
     std::string reply        = "";
     char        buffer[8192] = {0};
 
-    sizeWritten = read(SERVERSOCKET, buffer, 8192);
-
-    if (sizeWritten < 0) {
-        std::cout << "Couldn't read (5)";
-        return;
-    }
-
-    reply += std::string(buffer, sizeWritten);
-
-    while (sizeWritten == 8192) {
-        sizeWritten = read(SERVERSOCKET, buffer, 8192);
+    // the reply may arrive in several chunks, the server closes the socket once it's all sent
+    while ((sizeWritten = read(SERVERSOCKET, buffer, 8192)) != 0) {
         if (sizeWritten < 0) {
+            if (errno == EINTR)
+                continue;
+
             std::cout << "Couldn't read (5)";
             return;
         }
+
         reply += std::string(buffer, sizeWritten);
     }
 
@@ -348,6 +351,20 @@ int main(int argc, char** argv) {
         request(fullRequest);
     else if (fullRequest.contains("/globalshortcuts"))
         request(fullRequest);
+    else if (fullRequest.contains("/rulecache"))
+        request(fullRequest);
+    else if (fullRequest.contains("/gputimes"))
+        request(fullRequest);
+    else if (fullRequest.contains("/frametimes"))
+        request(fullRequest);
+    else if (fullRequest.contains("/configbench"))
+        request(fullRequest);
+    else if (fullRequest.contains("/jsonbench"))
+        request(fullRequest);
+    else if (fullRequest.contains("/layoutbench"))
+        request(fullRequest);
+    else if (fullRequest.contains("/trace"))
+        request(fullRequest);
     else if (fullRequest.contains("/switchxkblayout"))
         request(fullRequest, 2);
     else if (fullRequest.contains("/seterror"))
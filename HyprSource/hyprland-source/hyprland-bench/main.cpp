@@ -0,0 +1,668 @@
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+const std::string USAGE = R"#(usage: hyprland-bench [(opt)flags]
+
+Runs Hyprland on the headless backend, plays scripted scenes and prints their frame timings as JSON.
+Without a GPU, load the vgem module for a render node and pass --software to render with llvmpipe.
+The ipc scenes also report request and event latencies of the hyprctl sockets.
+
+flags:
+    --hyprland PATH    -> compositor to run (default: Hyprland)
+    --outputs N        -> number of headless outputs (default: 1)
+    --resolution WxH   -> output resolution, repeat it to size outputs one by one (default: 1920x1080)
+    --scene NAME       -> only run this scene, can be repeated (default: all)
+    --client CMD       -> command opening one window (default: foot)
+    --windows N        -> windows per scene (default: 8)
+    --duration SECONDS -> measured time per scene (default: 5)
+    --suite NAME       -> render, ipc or all (default: all)
+    --pollers N        -> concurrent clients -j pollers in ipc-poll (default: 8)
+    --batch-size N     -> dispatches per batch in ipc-batch (default: 64)
+    --subscribers N    -> socket2 subscribers in ipc-events (default: 16)
+    --software         -> render with llvmpipe
+    -o FILE            -> write the report to FILE instead of stdout
+
+scenes:
+    tiled      -> a grid of tiled windows
+    floating   -> stacked floating windows
+    blur       -> translucent tiled windows with blur
+    shadows    -> floating windows with drop shadows
+    rounding   -> tiled windows with rounded corners
+    fancy      -> floating, blur, shadows and rounding together
+    workspaces -> switching workspaces with animations on
+    ipc-poll   -> tiled windows while pollers hammer clients -j
+    ipc-batch  -> tiled windows while batches of workspace switches come back to back
+    ipc-events -> tiled windows while socket2 subscribers receive workspace events
+)#";
+
+// what keeps the compositor busy while a scene is measured
+enum eSceneDriver
+{
+    DRIVER_IDLE = 0,
+    DRIVER_WORKSPACES,
+    DRIVER_IPC_POLL,
+    DRIVER_IPC_BATCH,
+    DRIVER_IPC_EVENTS
+};
+
+struct SScene {
+    std::string              name;
+    std::vector<std::string> keywords;              // applied on top of BASELINE
+    bool                     floating = false;      // float every window once it's mapped
+    eSceneDriver             driver   = DRIVER_IDLE;
+};
+
+// every scene starts from here, so no scene leaks its settings into the next one
+const std::vector<std::string> BASELINE = {
+    "decoration:rounding 0", "decoration:blur 0", "decoration:drop_shadow 0", "decoration:active_opacity 1.0", "decoration:inactive_opacity 1.0", "animations:enabled 0",
+};
+
+const std::vector<SScene> SCENES = {
+    {"tiled", {}},
+    {"floating", {}, true},
+    {"blur", {"decoration:blur 1", "decoration:active_opacity 0.8", "decoration:inactive_opacity 0.8"}},
+    {"shadows", {"decoration:drop_shadow 1"}, true},
+    {"rounding", {"decoration:rounding 10"}},
+    {"fancy", {"decoration:blur 1", "decoration:active_opacity 0.8", "decoration:inactive_opacity 0.8", "decoration:drop_shadow 1", "decoration:rounding 10"}, true},
+    {"workspaces", {"animations:enabled 1"}, false, DRIVER_WORKSPACES},
+    {"ipc-poll", {}, false, DRIVER_IPC_POLL},
+    {"ipc-batch", {}, false, DRIVER_IPC_BATCH},
+    {"ipc-events", {}, false, DRIVER_IPC_EVENTS},
+};
+
+// vfr off and no damage tracking make every vblank a full frame, so static windows still cost something
+const std::string CONFIG = R"#(
+misc {
+    vfr = false
+    disable_hyprland_logo = true
+    disable_splash_rendering = true
+}
+
+debug {
+    damage_tracking = 0
+    gpu_timers = true
+}
+)#";
+
+struct SOptions {
+    std::string              hyprland = "Hyprland";
+    int                      outputs  = 1;
+    std::vector<std::string> resolutions;
+    std::vector<std::string> scenes;
+    std::string              client      = "foot";
+    int                      windows     = 8;
+    int                      duration    = 5;
+    bool                     software    = false;
+    std::string              output      = "";
+    std::string              suite       = "all";
+    int                      pollers     = 8;
+    int                      batchSize   = 64;
+    int                      subscribers = 16;
+};
+
+pid_t       hyprlandPID = -1;
+std::string instanceSig = "";
+
+void        fail(const std::string& why) {
+    std::cerr << "hyprland-bench: " << why << "\n";
+
+    if (hyprlandPID > 0) {
+        kill(hyprlandPID, SIGTERM);
+        waitpid(hyprlandPID, nullptr, 0);
+    }
+
+    exit(1);
+}
+
+int connectTo(const std::string& socketName) {
+    const auto SERVERSOCKET = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (SERVERSOCKET < 0)
+        fail("couldn't open a socket");
+
+    sockaddr_un serverAddress = {0};
+    serverAddress.sun_family  = AF_UNIX;
+
+    const std::string socketPath = "/tmp/hypr/" + instanceSig + "/" + socketName;
+
+    strcpy(serverAddress.sun_path, socketPath.c_str());
+
+    if (connect(SERVERSOCKET, (sockaddr*)&serverAddress, SUN_LEN(&serverAddress)) < 0)
+        fail("couldn't connect to " + socketPath);
+
+    return SERVERSOCKET;
+}
+
+std::string request(const std::string& arg) {
+    const auto        SERVERSOCKET = connectTo(".socket.sock");
+    const std::string socketPath   = "/tmp/hypr/" + instanceSig + "/.socket.sock";
+
+    if (write(SERVERSOCKET, arg.c_str(), arg.length()) < 0)
+        fail("couldn't write to " + socketPath);
+
+    std::string reply        = "";
+    char        buffer[8192] = {0};
+    ssize_t     sizeRead     = 0;
+
+    while ((sizeRead = read(SERVERSOCKET, buffer, 8192)) != 0) {
+        if (sizeRead < 0) {
+            if (errno == EINTR)
+                continue;
+
+            fail("couldn't read from " + socketPath);
+        }
+
+        reply += std::string(buffer, sizeRead);
+    }
+
+    close(SERVERSOCKET);
+
+    return reply;
+}
+
+void batch(const std::string& command, const std::vector<std::string>& args) {
+    std::string req = "[[BATCH]]";
+
+    for (auto& a : args)
+        req += command + " " + a + ";";
+
+    request(req);
+}
+
+// the string or number values of every "key": in a reply, good enough for the flat objects hyprctl sends
+std::vector<std::string> jsonValues(const std::string& json, const std::string& key) {
+    std::vector<std::string> values;
+
+    const std::string NEEDLE = "\"" + key + "\": ";
+    size_t            pos    = 0;
+
+    while ((pos = json.find(NEEDLE, pos)) != std::string::npos) {
+        pos += NEEDLE.length();
+
+        if (json[pos] == '"') {
+            const auto END = json.find('"', pos + 1);
+            values.push_back(json.substr(pos + 1, END - pos - 1));
+        } else
+            values.push_back(json.substr(pos, json.find_first_of(",}\n", pos) - pos));
+    }
+
+    return values;
+}
+
+std::string jsonEscape(const std::string& str) {
+    std::string result = "";
+
+    for (auto& c : str) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+
+        if (c == '\n')
+            result += "\\n";
+        else if ((unsigned char)c >= 0x20)
+            result += c;
+    }
+
+    return result;
+}
+
+// hyprctl replies plain text for errors even with -j, keep those as strings
+std::string embed(const std::string& reply) {
+    if (!reply.empty() && (reply[0] == '[' || reply[0] == '{'))
+        return reply;
+
+    return "\"" + jsonEscape(reply) + "\"";
+}
+
+bool waitFor(const std::function<bool()>& condition, int timeoutMs = 10000) {
+    const auto BEGIN = std::chrono::steady_clock::now();
+
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() - BEGIN > std::chrono::milliseconds(timeoutMs))
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    return true;
+}
+
+std::set<std::string> listInstances() {
+    std::set<std::string> instances;
+
+    if (!std::filesystem::exists("/tmp/hypr"))
+        return instances;
+
+    for (auto& entry : std::filesystem::directory_iterator("/tmp/hypr"))
+        instances.insert(entry.path().filename().string());
+
+    return instances;
+}
+
+void startHyprland(const SOptions& options, const std::string& configPath) {
+    const auto INSTANCESBEFORE = listInstances();
+
+    hyprlandPID = fork();
+
+    if (hyprlandPID < 0)
+        fail("couldn't fork");
+
+    if (hyprlandPID == 0) {
+        setenv("WLR_BACKENDS", "headless", true);
+        setenv("WLR_HEADLESS_OUTPUTS", std::to_string(options.outputs).c_str(), true);
+        setenv("WLR_RENDERER_ALLOW_SOFTWARE", "1", true);
+
+        if (options.software) {
+            setenv("LIBGL_ALWAYS_SOFTWARE", "1", true);
+            setenv("GALLIUM_DRIVER", "llvmpipe", true);
+        }
+
+        // the bench's own stdout is the report
+        const auto DEVNULL = fopen("/dev/null", "w");
+        dup2(fileno(DEVNULL), STDOUT_FILENO);
+
+        execlp(options.hyprland.c_str(), options.hyprland.c_str(), "--config", configPath.c_str(), nullptr);
+        _exit(127);
+    }
+
+    const bool STARTED = waitFor([&]() {
+        if (waitpid(hyprlandPID, nullptr, WNOHANG) == hyprlandPID) {
+            hyprlandPID = -1;
+            fail("Hyprland exited during startup, see its log in /tmp/hypr");
+        }
+
+        for (auto& sig : listInstances()) {
+            if (!INSTANCESBEFORE.contains(sig) && std::filesystem::exists("/tmp/hypr/" + sig + "/.socket.sock")) {
+                instanceSig = sig;
+                return true;
+            }
+        }
+
+        return false;
+    });
+
+    if (!STARTED)
+        fail("Hyprland didn't open its socket in time");
+}
+
+void setupOutputs(const SOptions& options) {
+    std::vector<std::string> names;
+
+    if (!waitFor([&]() {
+            names = jsonValues(request("j/monitors"), "name");
+            return (int)names.size() >= options.outputs;
+        }))
+        fail("expected " + std::to_string(options.outputs) + " outputs, got " + std::to_string(names.size()));
+
+    std::vector<std::string> rules;
+    int                      x = 0;
+
+    for (size_t i = 0; i < names.size(); ++i) {
+        const auto RESOLUTION = options.resolutions.empty() ? "1920x1080" : options.resolutions[std::min(i, options.resolutions.size() - 1)];
+
+        rules.push_back(names[i] + "," + RESOLUTION + "@60," + std::to_string(x) + "x0,1");
+
+        x += std::stoi(RESOLUTION.substr(0, RESOLUTION.find('x')));
+    }
+
+    batch("keyword monitor", rules);
+}
+
+void closeAllWindows() {
+    for (auto& pid : jsonValues(request("j/clients"), "pid")) {
+        if (pid != "-1")
+            kill(std::stoi(pid), SIGTERM);
+    }
+
+    if (!waitFor([]() { return jsonValues(request("j/clients"), "pid").empty(); }))
+        fail("windows from the previous scene didn't close");
+}
+
+int64_t steadyNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// count, rate and percentiles of latencies in ms
+std::string latencyStats(std::vector<float> ms, int seconds) {
+    std::sort(ms.begin(), ms.end());
+
+    const auto PERCENTILE = [&](float p) { return ms.empty() ? 0.f : ms[std::min(ms.size() - 1, (size_t)(p * ms.size()))]; };
+
+    double sum = 0;
+    for (auto& m : ms)
+        sum += m;
+
+    char buf[512];
+    snprintf(buf, sizeof(buf), "{\"count\": %zu, \"perSecond\": %.1f, \"avg\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f}", ms.size(),
+             (double)ms.size() / seconds, ms.empty() ? 0.0 : sum / ms.size(), PERCENTILE(0.5f), PERCENTILE(0.95f), PERCENTILE(0.99f), ms.empty() ? 0.f : ms.back());
+
+    return buf;
+}
+
+std::vector<float> mergeLatencies(const std::vector<std::vector<float>>& perThread) {
+    std::vector<float> all;
+
+    for (auto& l : perThread)
+        all.insert(all.end(), l.begin(), l.end());
+
+    return all;
+}
+
+// concurrent clients -j requests, each on its own connection like hyprctl does
+std::string drivePollers(const SOptions& options) {
+    std::vector<std::vector<float>> latencies(options.pollers);
+    std::vector<std::thread>        threads;
+    std::atomic<bool>               stop = false;
+
+    for (int i = 0; i < options.pollers; ++i) {
+        threads.emplace_back([&, i]() {
+            while (!stop) {
+                const auto BEGIN = steadyNs();
+                request("j/clients");
+                latencies[i].push_back((steadyNs() - BEGIN) / 1000000.f);
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(options.duration));
+    stop = true;
+
+    for (auto& t : threads)
+        t.join();
+
+    return ", \"pollers\": " + std::to_string(options.pollers) + ", \"requests\": " + latencyStats(mergeLatencies(latencies), options.duration);
+}
+
+// back to back batches, every dispatch in them switches the workspace
+std::string driveBatches(const SOptions& options) {
+    std::string req = "[[BATCH]]";
+
+    for (int i = 0; i < options.batchSize; ++i)
+        req += std::string("dispatch workspace ") + (i % 2 == 0 ? "2" : "1") + ";";
+
+    std::vector<float> latencies;
+    const auto         END = steadyNs() + options.duration * 1000000000LL;
+
+    while (steadyNs() < END) {
+        const auto BEGIN = steadyNs();
+        request(req);
+        latencies.push_back((steadyNs() - BEGIN) / 1000000.f);
+    }
+
+    request("dispatch workspace 1");
+
+    return ", \"batchSize\": " + std::to_string(options.batchSize) + ", \"batches\": " + latencyStats(latencies, options.duration);
+}
+
+// socket2 subscribers timing how long a workspace event takes from the dispatch to them.
+// every dispatch goes to a new named workspace, so a late event is still timed against its own send.
+std::string driveEvents(const SOptions& options) {
+    std::vector<std::vector<float>>          latencies(options.subscribers);
+    std::vector<std::thread>                 threads;
+    std::atomic<bool>                        stop  = false;
+    std::atomic<int>                         ready = 0;
+    std::mutex                               sentMutex;
+    std::unordered_map<std::string, int64_t> sentAt;
+
+    for (int i = 0; i < options.subscribers; ++i) {
+        threads.emplace_back([&, i]() {
+            const auto        FD        = connectTo(".socket2.sock");
+            const std::string SUBSCRIBE = "subscribe workspace\n";
+
+            if (write(FD, SUBSCRIBE.c_str(), SUBSCRIBE.length()) < 0)
+                fail("couldn't subscribe to socket2");
+
+            ready++;
+
+            std::string buffer = "";
+            char        chunk[4096];
+            pollfd      pfd = {FD, POLLIN, 0};
+
+            while (!stop) {
+                if (poll(&pfd, 1, 100) <= 0)
+                    continue;
+
+                const auto LEN = read(FD, chunk, sizeof(chunk));
+                if (LEN <= 0)
+                    break;
+
+                const auto RECEIVED = steadyNs();
+                buffer.append(chunk, LEN);
+
+                size_t newline = 0;
+                while ((newline = buffer.find('\n')) != std::string::npos) {
+                    if (buffer.starts_with("workspace>>")) {
+                        std::lock_guard<std::mutex> lg(sentMutex);
+                        const auto                  SENT = sentAt.find(buffer.substr(11, newline - 11));
+
+                        if (SENT != sentAt.end())
+                            latencies[i].push_back((RECEIVED - SENT->second) / 1000000.f);
+                    }
+
+                    buffer.erase(0, newline + 1);
+                }
+            }
+
+            close(FD);
+        });
+    }
+
+    if (!waitFor([&]() { return ready == options.subscribers; }))
+        fail("socket2 subscribers didn't connect in time");
+
+    // subscriptions are handled on the compositor's next loop iteration
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto END  = steadyNs() + options.duration * 1000000000LL;
+    int        sent = 0;
+
+    while (steadyNs() < END) {
+        const auto NAME = "bench" + std::to_string(sent);
+
+        {
+            std::lock_guard<std::mutex> lg(sentMutex);
+            sentAt[NAME] = steadyNs();
+        }
+
+        request("dispatch workspace name:" + NAME);
+        sent++;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop = true;
+
+    for (auto& t : threads)
+        t.join();
+
+    request("dispatch workspace 1");
+
+    const auto ALL = mergeLatencies(latencies);
+
+    return ", \"subscribers\": " + std::to_string(options.subscribers) + ", \"sent\": " + std::to_string(sent) + ", \"delivered\": " + std::to_string(ALL.size()) +
+        ", \"events\": " + latencyStats(ALL, options.duration);
+}
+
+std::string runScene(const SScene& scene, const SOptions& options) {
+    std::cerr << "hyprland-bench: running " << scene.name << "\n";
+
+    closeAllWindows();
+
+    auto keywords = BASELINE;
+    keywords.insert(keywords.end(), scene.keywords.begin(), scene.keywords.end());
+    batch("keyword", keywords);
+
+    request("dispatch workspace 1");
+
+    for (int i = 0; i < options.windows; ++i)
+        request("dispatch exec " + options.client);
+
+    if (!waitFor([&]() { return (int)jsonValues(request("j/clients"), "pid").size() >= options.windows; }))
+        fail("\"" + options.client + "\" didn't open " + std::to_string(options.windows) + " windows in time");
+
+    if (scene.floating) {
+        std::vector<std::string> floats;
+
+        for (auto& address : jsonValues(request("j/clients"), "address"))
+            floats.push_back("togglefloating address:" + address);
+
+        batch("dispatch", floats);
+    }
+
+    // let the clients draw their first frames and the layout settle before measuring
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    request("frametimes reset");
+
+    std::string driverStats = "";
+
+    switch (scene.driver) {
+        case DRIVER_IPC_POLL: driverStats = drivePollers(options); break;
+        case DRIVER_IPC_BATCH: driverStats = driveBatches(options); break;
+        case DRIVER_IPC_EVENTS: driverStats = driveEvents(options); break;
+        default: {
+            const auto END       = steadyNs() + options.duration * 1000000000LL;
+            int        workspace = 1;
+
+            while (steadyNs() < END) {
+                if (scene.driver == DRIVER_WORKSPACES) {
+                    workspace = workspace == 1 ? 2 : 1;
+                    request("dispatch workspace " + std::to_string(workspace));
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            }
+        }
+    }
+
+    const auto FRAMETIMES = request("j/frametimes");
+    const auto GPUTIMES   = request("j/gputimes");
+
+    return "{\"name\": \"" + scene.name + "\", \"windows\": " + std::to_string(options.windows) + ", \"duration\": " + std::to_string(options.duration) + driverStats +
+        ", \"frametimes\": " + embed(FRAMETIMES) + ", \"gputimes\": " + embed(GPUTIMES) + "}";
+}
+
+int main(int argc, char** argv) {
+    SOptions                 options;
+    std::vector<std::string> args{argv + 1, argv + argc};
+
+    for (auto it = args.begin(); it != args.end(); it++) {
+        const bool HASVALUE = it + 1 != args.end();
+
+        if (*it == "-h" || *it == "--help") {
+            std::cout << USAGE;
+            return 0;
+        } else if (*it == "--software")
+            options.software = true;
+        else if (!HASVALUE) {
+            std::cerr << USAGE;
+            return 1;
+        } else if (*it == "--hyprland")
+            options.hyprland = *++it;
+        else if (*it == "--outputs")
+            options.outputs = std::stoi(*++it);
+        else if (*it == "--resolution")
+            options.resolutions.push_back(*++it);
+        else if (*it == "--scene")
+            options.scenes.push_back(*++it);
+        else if (*it == "--client")
+            options.client = *++it;
+        else if (*it == "--windows")
+            options.windows = std::stoi(*++it);
+        else if (*it == "--duration")
+            options.duration = std::stoi(*++it);
+        else if (*it == "--suite")
+            options.suite = *++it;
+        else if (*it == "--pollers")
+            options.pollers = std::stoi(*++it);
+        else if (*it == "--batch-size")
+            options.batchSize = std::stoi(*++it);
+        else if (*it == "--subscribers")
+            options.subscribers = std::stoi(*++it);
+        else if (*it == "-o")
+            options.output = *++it;
+        else {
+            std::cerr << USAGE;
+            return 1;
+        }
+    }
+
+    for (auto& name : options.scenes) {
+        if (std::find_if(SCENES.begin(), SCENES.end(), [&](const SScene& s) { return s.name == name; }) == SCENES.end())
+            fail("no scene called " + name);
+    }
+
+    for (auto& res : options.resolutions) {
+        const auto X = res.find('x');
+        if (X == std::string::npos || X == 0 || X == res.length() - 1 || res.find_first_not_of("0123456789x") != std::string::npos)
+            fail("resolution " + res + " isn't WxH");
+    }
+
+    if (options.suite != "render" && options.suite != "ipc" && options.suite != "all")
+        fail("no suite called " + options.suite);
+
+    if (options.outputs < 1 || options.windows < 1 || options.duration < 1 || options.pollers < 1 || options.batchSize < 1 || options.subscribers < 1)
+        fail("outputs, windows, duration, pollers, batch size and subscribers have to be at least 1");
+
+    if (!getenv("XDG_RUNTIME_DIR"))
+        fail("XDG_RUNTIME_DIR is not set");
+
+    const auto CONFIGPATH = std::filesystem::temp_directory_path() / ("hyprland-bench-" + std::to_string(getpid()) + ".conf");
+    std::ofstream(CONFIGPATH) << CONFIG;
+
+    startHyprland(options, CONFIGPATH.string());
+    setupOutputs(options);
+
+    std::string report = "{\n\"version\": " + embed(request("j/version")) + ",\n\"monitors\": " + embed(request("j/monitors")) + ",\n\"scenes\": [";
+
+    bool first = true;
+    for (auto& scene : SCENES) {
+        if (!options.scenes.empty() && std::find(options.scenes.begin(), options.scenes.end(), scene.name) == options.scenes.end())
+            continue;
+
+        const bool IPC = scene.driver >= DRIVER_IPC_POLL;
+        if ((options.suite == "render" && IPC) || (options.suite == "ipc" && !IPC))
+            continue;
+
+        report += std::string(first ? "\n" : ",\n") + runScene(scene, options);
+        first = false;
+    }
+
+    report += "\n]\n}\n";
+
+    closeAllWindows();
+
+    kill(hyprlandPID, SIGTERM);
+    waitpid(hyprlandPID, nullptr, 0);
+    std::filesystem::remove(CONFIGPATH);
+
+    if (options.output.empty())
+        std::cout << report;
+    else
+        std::ofstream(options.output) << report;
+
+    return 0;
+}
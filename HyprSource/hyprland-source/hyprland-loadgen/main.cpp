@@ -0,0 +1,624 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <wayland-client.h>
+#include "xdg-shell-client-protocol.h"
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+const std::string USAGE = R"#(usage: hyprland-loadgen [(opt)flags]
+
+Opens toplevels with popups and subsurfaces and keeps committing to them. At exit, it prints
+the commit to frame callback latency of every surface as JSON.
+
+flags:
+    --toplevels N       -> toplevels to open (default: 4)
+    --popups N          -> popups per toplevel (default: 1)
+    --subsurfaces N     -> subsurfaces per toplevel (default: 2)
+    --damage N          -> side of the square damaged per commit, 0 damages everything (default: 64)
+    --rate HZ           -> commits per second per surface, 0 commits on every frame callback (default: 0)
+    --title-rate HZ     -> title changes per second per toplevel (default: 0)
+    --duration SECONDS  -> run time, 0 runs until interrupted (default: 10)
+)#";
+
+struct SOptions {
+    int   toplevels   = 4;
+    int   popups      = 1;
+    int   subsurfaces = 2;
+    int   damage      = 64;
+    float rate        = 0;
+    float titleRate   = 0;
+    int   duration    = 10;
+};
+
+struct SSurface;
+
+struct SBuffer {
+    SSurface*  owner  = nullptr;
+    wl_buffer* buffer = nullptr;
+    uint32_t*  data   = nullptr;
+    size_t     size   = 0;
+    int        width  = 0;
+    int        height = 0;
+    bool       busy   = false;
+};
+
+enum eSurfaceRole
+{
+    ROLE_TOPLEVEL = 0,
+    ROLE_POPUP,
+    ROLE_SUBSURFACE
+};
+
+const char* ROLE_NAMES[] = {"toplevel", "popup", "subsurface"};
+
+struct SSurface {
+    std::string    name;
+    eSurfaceRole   role   = ROLE_TOPLEVEL;
+    SSurface*      parent = nullptr;
+
+    wl_surface*    surface       = nullptr;
+    wl_subsurface* subsurface    = nullptr;
+    xdg_surface*   xdgSurface    = nullptr;
+    xdg_toplevel*  toplevel      = nullptr;
+    xdg_popup*     popup         = nullptr;
+    wl_callback*   frameCallback = nullptr; // the one gating the next commit, see pendingFrames
+
+    SBuffer        buffers[2];
+
+    int            width         = 0;
+    int            height        = 0;
+    int            pendingWidth  = 0; // from the last configure, 0 lets us pick
+    int            pendingHeight = 0;
+    bool           configured    = false;
+    bool           closed        = false;
+    bool           wantsCommit   = false; // the rate timer fired while a frame callback was outstanding
+
+    uint64_t       commits = 0;
+    uint64_t       titles  = 0;
+    uint32_t       frame   = 0;
+
+    std::vector<std::pair<wl_callback*, uint64_t>> pendingFrames; // every callback in flight and the CLOCK_MONOTONIC ns of its commit
+    std::vector<float>                             latencies;     // ms from commit to frame callback
+};
+
+struct SClient {
+    SOptions                               options;
+
+    wl_display*                            display       = nullptr;
+    wl_registry*                           registry      = nullptr;
+    wl_compositor*                         compositor    = nullptr;
+    wl_subcompositor*                      subcompositor = nullptr;
+    wl_shm*                                shm           = nullptr;
+    xdg_wm_base*                           wmBase        = nullptr;
+
+    std::vector<std::unique_ptr<SSurface>> surfaces;
+} g_client;
+
+volatile sig_atomic_t g_running = 1;
+
+uint64_t              nowNs() {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+void commitSurface(SSurface* pSurface);
+
+//
+// buffers
+//
+
+void bufferRelease(void* data, wl_buffer* buffer) {
+    const auto PBUFFER = (SBuffer*)data;
+
+    PBUFFER->busy = false;
+
+    // commitSurface found both buffers busy, retry now that one is free. With a frame callback outstanding, frameDone will.
+    if (PBUFFER->owner && PBUFFER->owner->wantsCommit && !PBUFFER->owner->frameCallback)
+        commitSurface(PBUFFER->owner);
+}
+
+const wl_buffer_listener bufferListener = {
+    .release = bufferRelease,
+};
+
+void destroyBuffer(SBuffer* pBuffer) {
+    if (!pBuffer->buffer)
+        return;
+
+    wl_buffer_destroy(pBuffer->buffer);
+    munmap(pBuffer->data, pBuffer->size);
+
+    *pBuffer = SBuffer{};
+}
+
+bool createBuffer(SBuffer* pBuffer, SSurface* pOwner, int width, int height) {
+    destroyBuffer(pBuffer);
+
+    const int STRIDE = width * 4;
+    const auto SIZE  = (size_t)STRIDE * height;
+
+    const int FD = memfd_create("hyprland-loadgen", MFD_CLOEXEC);
+    if (FD < 0)
+        return false;
+
+    if (ftruncate(FD, SIZE) < 0) {
+        close(FD);
+        return false;
+    }
+
+    const auto DATA = mmap(nullptr, SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, FD, 0);
+    if (DATA == MAP_FAILED) {
+        close(FD);
+        return false;
+    }
+
+    const auto POOL = wl_shm_create_pool(g_client.shm, FD, SIZE);
+    pBuffer->buffer = wl_shm_pool_create_buffer(POOL, 0, width, height, STRIDE, WL_SHM_FORMAT_ARGB8888);
+    wl_shm_pool_destroy(POOL);
+    close(FD);
+
+    pBuffer->owner  = pOwner;
+    pBuffer->data   = (uint32_t*)DATA;
+    pBuffer->size   = SIZE;
+    pBuffer->width  = width;
+    pBuffer->height = height;
+
+    wl_buffer_add_listener(pBuffer->buffer, &bufferListener, pBuffer);
+
+    return true;
+}
+
+void fillRect(SBuffer* pBuffer, int x, int y, int w, int h, uint32_t color) {
+    for (int row = y; row < y + h; ++row)
+        std::fill_n(pBuffer->data + (size_t)row * pBuffer->width + x, w, color);
+}
+
+//
+// surfaces
+//
+
+void frameDone(void* data, wl_callback* callback, uint32_t time) {
+    const auto PSURFACE = (SSurface*)data;
+    const auto IT       = std::find_if(PSURFACE->pendingFrames.begin(), PSURFACE->pendingFrames.end(), [&](const auto& other) { return other.first == callback; });
+
+    if (IT != PSURFACE->pendingFrames.end()) {
+        PSURFACE->latencies.push_back((nowNs() - IT->second) / 1000000.f);
+        PSURFACE->pendingFrames.erase(IT);
+    }
+
+    // one that a configure stopped waiting for, its sample still counts but it doesn't drive commits anymore
+    const bool GATING = callback == PSURFACE->frameCallback;
+
+    wl_callback_destroy(callback);
+
+    if (!GATING)
+        return;
+
+    PSURFACE->frameCallback = nullptr;
+
+    if (g_client.options.rate == 0 || PSURFACE->wantsCommit)
+        commitSurface(PSURFACE);
+}
+
+const wl_callback_listener frameListener = {
+    .done = frameDone,
+};
+
+void commitSurface(SSurface* pSurface) {
+    if (!pSurface->configured || pSurface->closed)
+        return;
+
+    if (pSurface->frameCallback) {
+        pSurface->wantsCommit = true;
+        return;
+    }
+
+    pSurface->wantsCommit = false;
+
+    SBuffer* pBuffer = nullptr;
+    for (auto& b : pSurface->buffers) {
+        if (!b.busy) {
+            pBuffer = &b;
+            break;
+        }
+    }
+
+    // both buffers are still held by the compositor, try again on the next tick
+    if (!pBuffer) {
+        pSurface->wantsCommit = true;
+        return;
+    }
+
+    bool fullDamage = g_client.options.damage == 0;
+
+    if (pBuffer->width != pSurface->width || pBuffer->height != pSurface->height) {
+        if (!createBuffer(pBuffer, pSurface, pSurface->width, pSurface->height)) {
+            std::cerr << "hyprland-loadgen: couldn't allocate a " << pSurface->width << "x" << pSurface->height << " buffer\n";
+            g_running = 0;
+            return;
+        }
+
+        fillRect(pBuffer, 0, 0, pSurface->width, pSurface->height, 0xFF202020 + pSurface->role * 0x202020);
+        fullDamage = true;
+    }
+
+    pSurface->frame++;
+
+    // a square that wanders across the surface, changing color every frame
+    const int SIDE = std::min({g_client.options.damage, pSurface->width, pSurface->height});
+    const int X    = fullDamage ? 0 : (pSurface->frame * 17) % std::max(1, pSurface->width - SIDE + 1);
+    const int Y    = fullDamage ? 0 : (pSurface->frame * 31) % std::max(1, pSurface->height - SIDE + 1);
+    const int W    = fullDamage ? pSurface->width : SIDE;
+    const int H    = fullDamage ? pSurface->height : SIDE;
+
+    fillRect(pBuffer, X, Y, W, H, 0xFF000000 | ((pSurface->frame * 0x10305) & 0xFFFFFF));
+
+    wl_surface_attach(pSurface->surface, pBuffer->buffer, 0, 0);
+    wl_surface_damage_buffer(pSurface->surface, X, Y, W, H);
+
+    pSurface->frameCallback = wl_surface_frame(pSurface->surface);
+    wl_callback_add_listener(pSurface->frameCallback, &frameListener, pSurface);
+
+    pBuffer->busy = true;
+    pSurface->pendingFrames.emplace_back(pSurface->frameCallback, nowNs());
+    pSurface->commits++;
+
+    wl_surface_commit(pSurface->surface);
+}
+
+void createPopups(SSurface* pParent);
+
+void xdgSurfaceConfigure(void* data, xdg_surface* xdgSurface, uint32_t serial) {
+    const auto PSURFACE = (SSurface*)data;
+
+    xdg_surface_ack_configure(xdgSurface, serial);
+
+    const bool FIRST = !PSURFACE->configured;
+
+    PSURFACE->width      = PSURFACE->pendingWidth > 0 ? PSURFACE->pendingWidth : 640;
+    PSURFACE->height     = PSURFACE->pendingHeight > 0 ? PSURFACE->pendingHeight : 480;
+    PSURFACE->configured = true;
+
+    // answer the configure right away instead of waiting for the outstanding frame.
+    // the callback stays alive in pendingFrames, so its latency sample isn't lost
+    PSURFACE->frameCallback = nullptr;
+
+    commitSurface(PSURFACE);
+
+    if (FIRST && PSURFACE->role == ROLE_TOPLEVEL)
+        createPopups(PSURFACE);
+}
+
+const xdg_surface_listener xdgSurfaceListener = {
+    .configure = xdgSurfaceConfigure,
+};
+
+void toplevelConfigure(void* data, xdg_toplevel* toplevel, int32_t width, int32_t height, wl_array* states) {
+    const auto PSURFACE     = (SSurface*)data;
+    PSURFACE->pendingWidth  = width;
+    PSURFACE->pendingHeight = height;
+}
+
+void toplevelClose(void* data, xdg_toplevel* toplevel) {
+    ((SSurface*)data)->closed = true;
+}
+
+const xdg_toplevel_listener toplevelListener = {
+    .configure = toplevelConfigure,
+    .close     = toplevelClose,
+};
+
+void popupConfigure(void* data, xdg_popup* popup, int32_t x, int32_t y, int32_t width, int32_t height) {
+    const auto PSURFACE     = (SSurface*)data;
+    PSURFACE->pendingWidth  = width;
+    PSURFACE->pendingHeight = height;
+}
+
+void popupDone(void* data, xdg_popup* popup) {
+    ((SSurface*)data)->closed = true;
+}
+
+const xdg_popup_listener popupListener = {
+    .configure  = popupConfigure,
+    .popup_done = popupDone,
+};
+
+SSurface* newSurface(eSurfaceRole role, SSurface* pParent, const std::string& name) {
+    const auto PSURFACE = g_client.surfaces.emplace_back(std::make_unique<SSurface>()).get();
+
+    PSURFACE->name    = name;
+    PSURFACE->role    = role;
+    PSURFACE->parent  = pParent;
+    PSURFACE->surface = wl_compositor_create_surface(g_client.compositor);
+
+    return PSURFACE;
+}
+
+void createPopups(SSurface* pParent) {
+    for (int i = 0; i < g_client.options.popups; ++i) {
+        const auto PSURFACE = newSurface(ROLE_POPUP, pParent, pParent->name + "/popup" + std::to_string(i));
+
+        const auto POSITIONER = xdg_wm_base_create_positioner(g_client.wmBase);
+        xdg_positioner_set_size(POSITIONER, 200, 150);
+        xdg_positioner_set_anchor_rect(POSITIONER, 0, 0, 1, 1);
+        xdg_positioner_set_anchor(POSITIONER, XDG_POSITIONER_ANCHOR_TOP_LEFT);
+        xdg_positioner_set_gravity(POSITIONER, XDG_POSITIONER_GRAVITY_BOTTOM_RIGHT);
+        xdg_positioner_set_offset(POSITIONER, 20 + i * 40, 20 + i * 40);
+
+        PSURFACE->xdgSurface = xdg_wm_base_get_xdg_surface(g_client.wmBase, PSURFACE->surface);
+        xdg_surface_add_listener(PSURFACE->xdgSurface, &xdgSurfaceListener, PSURFACE);
+
+        PSURFACE->popup = xdg_surface_get_popup(PSURFACE->xdgSurface, pParent->xdgSurface, POSITIONER);
+        xdg_popup_add_listener(PSURFACE->popup, &popupListener, PSURFACE);
+
+        xdg_positioner_destroy(POSITIONER);
+
+        wl_surface_commit(PSURFACE->surface);
+    }
+}
+
+void createToplevel(int id) {
+    const auto PSURFACE = newSurface(ROLE_TOPLEVEL, nullptr, "toplevel" + std::to_string(id));
+
+    PSURFACE->xdgSurface = xdg_wm_base_get_xdg_surface(g_client.wmBase, PSURFACE->surface);
+    xdg_surface_add_listener(PSURFACE->xdgSurface, &xdgSurfaceListener, PSURFACE);
+
+    PSURFACE->toplevel = xdg_surface_get_toplevel(PSURFACE->xdgSurface);
+    xdg_toplevel_add_listener(PSURFACE->toplevel, &toplevelListener, PSURFACE);
+    xdg_toplevel_set_title(PSURFACE->toplevel, ("hyprland-loadgen " + PSURFACE->name).c_str());
+    xdg_toplevel_set_app_id(PSURFACE->toplevel, "hyprland-loadgen");
+
+    // subsurfaces don't get configures, they are mapped together with their parent
+    for (int i = 0; i < g_client.options.subsurfaces; ++i) {
+        const auto PSUB = newSurface(ROLE_SUBSURFACE, PSURFACE, PSURFACE->name + "/sub" + std::to_string(i));
+
+        PSUB->subsurface = wl_subcompositor_get_subsurface(g_client.subcompositor, PSUB->surface, PSURFACE->surface);
+        wl_subsurface_set_position(PSUB->subsurface, 40 + i * 60, 40 + i * 60);
+        wl_subsurface_set_desync(PSUB->subsurface);
+
+        PSUB->width      = 128;
+        PSUB->height     = 128;
+        PSUB->configured = true;
+
+        commitSurface(PSUB);
+    }
+
+    wl_surface_commit(PSURFACE->surface);
+}
+
+//
+// globals
+//
+
+void wmBasePing(void* data, xdg_wm_base* wmBase, uint32_t serial) {
+    xdg_wm_base_pong(wmBase, serial);
+}
+
+const xdg_wm_base_listener wmBaseListener = {
+    .ping = wmBasePing,
+};
+
+void registryGlobal(void* data, wl_registry* registry, uint32_t name, const char* interface, uint32_t version) {
+    if (strcmp(interface, wl_compositor_interface.name) == 0)
+        g_client.compositor = (wl_compositor*)wl_registry_bind(registry, name, &wl_compositor_interface, std::min(version, 4u));
+    else if (strcmp(interface, wl_subcompositor_interface.name) == 0)
+        g_client.subcompositor = (wl_subcompositor*)wl_registry_bind(registry, name, &wl_subcompositor_interface, 1);
+    else if (strcmp(interface, wl_shm_interface.name) == 0)
+        g_client.shm = (wl_shm*)wl_registry_bind(registry, name, &wl_shm_interface, 1);
+    else if (strcmp(interface, xdg_wm_base_interface.name) == 0) {
+        g_client.wmBase = (xdg_wm_base*)wl_registry_bind(registry, name, &xdg_wm_base_interface, 1);
+        xdg_wm_base_add_listener(g_client.wmBase, &wmBaseListener, nullptr);
+    }
+}
+
+void registryGlobalRemove(void* data, wl_registry* registry, uint32_t name) {
+    ;
+}
+
+const wl_registry_listener registryListener = {
+    .global        = registryGlobal,
+    .global_remove = registryGlobalRemove,
+};
+
+//
+// main loop
+//
+
+int createTimer(float hz) {
+    if (hz <= 0)
+        return -1;
+
+    const int      FD       = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    const uint64_t PERIODNS = 1000000000.0 / hz;
+
+    itimerspec     spec;
+    spec.it_interval = {(time_t)(PERIODNS / 1000000000ULL), (long)(PERIODNS % 1000000000ULL)};
+    spec.it_value    = spec.it_interval;
+    timerfd_settime(FD, 0, &spec, nullptr);
+
+    return FD;
+}
+
+bool timerFired(const pollfd& pfd) {
+    if (pfd.fd < 0 || !(pfd.revents & POLLIN))
+        return false;
+
+    uint64_t expirations = 0;
+    return read(pfd.fd, &expirations, sizeof(expirations)) == sizeof(expirations);
+}
+
+void runLoop() {
+    pollfd     fds[3] = {
+        {wl_display_get_fd(g_client.display), POLLIN, 0},
+        {createTimer(g_client.options.rate), POLLIN, 0},
+        {createTimer(g_client.options.titleRate), POLLIN, 0},
+    };
+
+    const auto END = g_client.options.duration > 0 ? nowNs() + g_client.options.duration * 1000000000ULL : 0;
+
+    while (g_running && (END == 0 || nowNs() < END)) {
+        while (wl_display_prepare_read(g_client.display) != 0)
+            wl_display_dispatch_pending(g_client.display);
+
+        wl_display_flush(g_client.display);
+
+        if (poll(fds, 3, 100) < 0) {
+            wl_display_cancel_read(g_client.display);
+
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        if (fds[0].revents & POLLIN)
+            wl_display_read_events(g_client.display);
+        else
+            wl_display_cancel_read(g_client.display);
+
+        if (fds[0].revents & (POLLERR | POLLHUP)) {
+            std::cerr << "hyprland-loadgen: lost the connection to the compositor\n";
+            break;
+        }
+
+        if (wl_display_dispatch_pending(g_client.display) < 0) {
+            std::cerr << "hyprland-loadgen: protocol error\n";
+            break;
+        }
+
+        if (timerFired(fds[1])) {
+            for (auto& s : g_client.surfaces)
+                commitSurface(s.get());
+        }
+
+        if (timerFired(fds[2])) {
+            for (auto& s : g_client.surfaces) {
+                if (s->role != ROLE_TOPLEVEL || s->closed)
+                    continue;
+
+                s->titles++;
+                xdg_toplevel_set_title(s->toplevel, ("hyprland-loadgen " + s->name + " #" + std::to_string(s->titles)).c_str());
+            }
+        }
+    }
+
+    for (int i = 1; i < 3; ++i) {
+        if (fds[i].fd >= 0)
+            close(fds[i].fd);
+    }
+}
+
+float percentile(const std::vector<float>& sorted, float p) {
+    if (sorted.empty())
+        return 0;
+
+    return sorted[std::min(sorted.size() - 1, (size_t)(p * sorted.size()))];
+}
+
+void printReport() {
+    std::cout << "[";
+
+    bool first = true;
+    for (auto& s : g_client.surfaces) {
+        auto& lat = s->latencies;
+        std::sort(lat.begin(), lat.end());
+
+        float sum = 0;
+        for (auto& l : lat)
+            sum += l;
+
+        std::cout << (first ? "\n" : ",\n");
+        std::cout << "{\"surface\": \"" << s->name << "\", \"role\": \"" << ROLE_NAMES[s->role] << "\", \"commits\": " << s->commits << ", \"frames\": " << lat.size()
+                  << ", \"titles\": " << s->titles << ", \"latencyMs\": {\"avg\": " << (lat.empty() ? 0 : sum / lat.size()) << ", \"p50\": " << percentile(lat, 0.5f)
+                  << ", \"p95\": " << percentile(lat, 0.95f) << ", \"p99\": " << percentile(lat, 0.99f) << ", \"max\": " << (lat.empty() ? 0 : lat.back()) << "}}";
+
+        first = false;
+    }
+
+    std::cout << "\n]\n";
+}
+
+int main(int argc, char** argv) {
+    auto&                    options = g_client.options;
+    std::vector<std::string> args{argv + 1, argv + argc};
+
+    try {
+        for (auto it = args.begin(); it != args.end(); it++) {
+            if (*it == "-h" || *it == "--help") {
+                std::cout << USAGE;
+                return 0;
+            } else if (it + 1 == args.end()) {
+                std::cerr << USAGE;
+                return 1;
+            } else if (*it == "--toplevels")
+                options.toplevels = std::stoi(*++it);
+            else if (*it == "--popups")
+                options.popups = std::stoi(*++it);
+            else if (*it == "--subsurfaces")
+                options.subsurfaces = std::stoi(*++it);
+            else if (*it == "--damage")
+                options.damage = std::stoi(*++it);
+            else if (*it == "--rate")
+                options.rate = std::stof(*++it);
+            else if (*it == "--title-rate")
+                options.titleRate = std::stof(*++it);
+            else if (*it == "--duration")
+                options.duration = std::stoi(*++it);
+            else {
+                std::cerr << USAGE;
+                return 1;
+            }
+        }
+    } catch (std::exception& e) {
+        std::cerr << "hyprland-loadgen: invalid argument value\n";
+        return 1;
+    }
+
+    if (options.toplevels < 1 || options.popups < 0 || options.subsurfaces < 0 || options.damage < 0 || options.rate < 0 || options.titleRate < 0 || options.duration < 0) {
+        std::cerr << "hyprland-loadgen: counts, sizes and rates can't be negative, and at least one toplevel is needed\n";
+        return 1;
+    }
+
+    g_client.display = wl_display_connect(nullptr);
+    if (!g_client.display) {
+        std::cerr << "hyprland-loadgen: couldn't connect to a wayland display\n";
+        return 1;
+    }
+
+    g_client.registry = wl_display_get_registry(g_client.display);
+    wl_registry_add_listener(g_client.registry, &registryListener, nullptr);
+    wl_display_roundtrip(g_client.display);
+
+    if (!g_client.compositor || !g_client.subcompositor || !g_client.shm || !g_client.wmBase) {
+        std::cerr << "hyprland-loadgen: the compositor lacks wl_compositor, wl_subcompositor, wl_shm or xdg_wm_base\n";
+        return 1;
+    }
+
+    signal(SIGINT, [](int) { g_running = 0; });
+    signal(SIGTERM, [](int) { g_running = 0; });
+
+    for (int i = 0; i < options.toplevels; ++i)
+        createToplevel(i);
+
+    runLoop();
+
+    printReport();
+
+    wl_display_disconnect(g_client.display);
+
+    return 0;
+}
@@ -275,6 +275,7 @@ void CCompositor::initAllSignals() {
     addWLSignal(&m_sWLRCursor->events.hold_end, &Events::listen_holdEnd, m_sWLRCursor, "WLRCursor");
     addWLSignal(&m_sWLRBackend->events.new_input, &Events::listen_newInput, m_sWLRBackend, "Backend");
     addWLSignal(&m_sSeat.seat->events.request_set_cursor, &Events::listen_requestMouse, &m_sSeat, "Seat");
+    addWLSignal(&m_sSeat.seat->pointer_state.events.focus_change, &Events::listen_pointerFocusChange, &m_sSeat, "Seat");
     addWLSignal(&m_sSeat.seat->events.request_set_selection, &Events::listen_requestSetSel, &m_sSeat, "Seat");
     addWLSignal(&m_sSeat.seat->events.request_start_drag, &Events::listen_requestDrag, &m_sSeat, "Seat");
     addWLSignal(&m_sSeat.seat->events.start_drag, &Events::listen_startDrag, &m_sSeat, "Seat");
@@ -318,9 +319,6 @@ void CCompositor::cleanup() {
     m_pLastFocus  = nullptr;
     m_pLastWindow = nullptr;
 
-    // end threads
-    g_pEventManager->m_tThread = std::thread();
-
     m_vWorkspaces.clear();
     m_vWindows.clear();
 
@@ -392,7 +390,7 @@ void CCompositor::initManagers(eManagersInitStage stage) {
 
             Debug::log(LOG, "Creating the EventManager!");
             g_pEventManager = std::make_unique<CEventManager>();
-            g_pEventManager->startThread();
+            g_pEventManager->startSocket();
 
             Debug::log(LOG, "Creating the HyprDebugOverlay!");
             g_pDebugOverlay = std::make_unique<CHyprDebugOverlay>();
@@ -603,9 +601,9 @@ CWindow* CCompositor::vectorToWindowTiled(const Vector2D& pos) {
 
 CWindow* CCompositor::vectorToWindowIdeal(const Vector2D& pos) {
     const auto         PMONITOR          = getMonitorFromVector(pos);
-    static auto* const PRESIZEONBORDER   = &g_pConfigManager->getConfigValuePtr("general:resize_on_border")->intValue;
-    static auto* const PBORDERSIZE       = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
-    static auto* const PBORDERGRABEXTEND = &g_pConfigManager->getConfigValuePtr("general:extend_border_grab_area")->intValue;
+    static auto* const PRESIZEONBORDER   = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_RESIZE_ON_BORDER)->intValue;
+    static auto* const PBORDERSIZE       = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
+    static auto* const PBORDERGRABEXTEND = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_EXTEND_BORDER_GRAB_AREA)->intValue;
     const auto         BORDER_GRAB_AREA  = *PRESIZEONBORDER ? *PBORDERSIZE + *PBORDERGRABEXTEND : 0;
 
     // special workspace
@@ -881,8 +879,10 @@ void CCompositor::focusWindow(CWindow* pWindow, wlr_surface* pSurface) {
     }
 
     // Send an event
-    g_pEventManager->postEvent(SHyprIPCEvent{"activewindow", g_pXWaylandManager->getAppIDClass(pWindow) + "," + pWindow->m_szTitle});
-    g_pEventManager->postEvent(SHyprIPCEvent{"activewindowv2", getFormat("%x", pWindow)});
+    if (g_pEventManager->wantsEvent("activewindow"))
+        g_pEventManager->postEvent(windowIPCEvent("activewindow", g_pXWaylandManager->getAppIDClass(pWindow) + "," + pWindow->m_szTitle, pWindow));
+    if (g_pEventManager->wantsEvent("activewindowv2"))
+        g_pEventManager->postEvent(windowIPCEvent("activewindowv2", getFormat("%x", pWindow), pWindow));
 
     EMIT_HOOK_EVENT("activeWindow", pWindow);
 
@@ -1320,7 +1320,7 @@ void CCompositor::addToFadingOutSafe(CWindow* pWindow) {
 CWindow* CCompositor::getWindowInDirection(CWindow* pWindow, char dir) {
 
     // 0 -> history, 1 -> shared length
-    static auto* const PMETHOD = &g_pConfigManager->getConfigValuePtr("binds:focus_preferred_method")->intValue;
+    static auto* const PMETHOD = &g_pConfigManager->getConfigValuePtr(CFG_BINDS_FOCUS_PREFERRED_METHOD)->intValue;
 
     const auto         WINDOWIDEALBB = pWindow->getWindowIdealBoundingBoxIgnoreReserved();
 
@@ -1589,6 +1589,11 @@ CMonitor* CCompositor::getMonitorInDirection(const char& dir) {
 }
 
 void CCompositor::updateAllWindowsAnimatedDecorationValues() {
+    if (m_sTransaction.depth > 0) {
+        m_sTransaction.updateDecorations = true;
+        return;
+    }
+
     for (auto& w : m_vWindows) {
         if (!w->m_bIsMapped)
             continue;
@@ -1599,16 +1604,16 @@ void CCompositor::updateAllWindowsAnimatedDecorationValues() {
 
 void CCompositor::updateWindowAnimatedDecorationValues(CWindow* pWindow) {
     // optimization
-    static auto* const ACTIVECOL          = (CGradientValueData*)g_pConfigManager->getConfigValuePtr("general:col.active_border")->data.get();
-    static auto* const INACTIVECOL        = (CGradientValueData*)g_pConfigManager->getConfigValuePtr("general:col.inactive_border")->data.get();
-    static auto* const GROUPACTIVECOL     = (CGradientValueData*)g_pConfigManager->getConfigValuePtr("general:col.group_border_active")->data.get();
-    static auto* const GROUPINACTIVECOL   = (CGradientValueData*)g_pConfigManager->getConfigValuePtr("general:col.group_border")->data.get();
-    static auto* const PINACTIVEALPHA     = &g_pConfigManager->getConfigValuePtr("decoration:inactive_opacity")->floatValue;
-    static auto* const PACTIVEALPHA       = &g_pConfigManager->getConfigValuePtr("decoration:active_opacity")->floatValue;
-    static auto* const PFULLSCREENALPHA   = &g_pConfigManager->getConfigValuePtr("decoration:fullscreen_opacity")->floatValue;
-    static auto* const PSHADOWCOL         = &g_pConfigManager->getConfigValuePtr("decoration:col.shadow")->intValue;
-    static auto* const PSHADOWCOLINACTIVE = &g_pConfigManager->getConfigValuePtr("decoration:col.shadow_inactive")->intValue;
-    static auto* const PDIMSTRENGTH       = &g_pConfigManager->getConfigValuePtr("decoration:dim_strength")->floatValue;
+    static auto* const ACTIVECOL          = (CGradientValueData*)g_pConfigManager->getConfigValuePtr(CFG_GENERAL_COL_ACTIVE_BORDER)->data.get();
+    static auto* const INACTIVECOL        = (CGradientValueData*)g_pConfigManager->getConfigValuePtr(CFG_GENERAL_COL_INACTIVE_BORDER)->data.get();
+    static auto* const GROUPACTIVECOL     = (CGradientValueData*)g_pConfigManager->getConfigValuePtr(CFG_GENERAL_COL_GROUP_BORDER_ACTIVE)->data.get();
+    static auto* const GROUPINACTIVECOL   = (CGradientValueData*)g_pConfigManager->getConfigValuePtr(CFG_GENERAL_COL_GROUP_BORDER)->data.get();
+    static auto* const PINACTIVEALPHA     = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_INACTIVE_OPACITY)->floatValue;
+    static auto* const PACTIVEALPHA       = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ACTIVE_OPACITY)->floatValue;
+    static auto* const PFULLSCREENALPHA   = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_FULLSCREEN_OPACITY)->floatValue;
+    static auto* const PSHADOWCOL         = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_COL_SHADOW)->intValue;
+    static auto* const PSHADOWCOLINACTIVE = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_COL_SHADOW_INACTIVE)->intValue;
+    static auto* const PDIMSTRENGTH       = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DIM_STRENGTH)->floatValue;
 
     auto               setBorderColor = [&](CGradientValueData grad) -> void {
         if (grad == pWindow->m_cRealBorderColor)
@@ -1753,9 +1758,9 @@ void CCompositor::swapActiveWorkspaces(CMonitor* pMonitorA, CMonitor* pMonitorB)
     g_pInputManager->refocus();
 
     // event
-    g_pEventManager->postEvent(SHyprIPCEvent{"moveworkspace", PWORKSPACEA->m_szName + "," + pMonitorB->szName});
+    g_pEventManager->postEvent(SHyprIPCEvent{"moveworkspace", PWORKSPACEA->m_szName + "," + pMonitorB->szName, pMonitorB->szName, PWORKSPACEA->m_szName});
     EMIT_HOOK_EVENT("moveWorkspace", (std::vector<void*>{PWORKSPACEA, pMonitorB}));
-    g_pEventManager->postEvent(SHyprIPCEvent{"moveworkspace", PWORKSPACEB->m_szName + "," + pMonitorA->szName});
+    g_pEventManager->postEvent(SHyprIPCEvent{"moveworkspace", PWORKSPACEB->m_szName + "," + pMonitorA->szName, pMonitorA->szName, PWORKSPACEB->m_szName});
     EMIT_HOOK_EVENT("moveWorkspace", (std::vector<void*>{PWORKSPACEB, pMonitorA}));
 }
 
@@ -1936,7 +1941,7 @@ void CCompositor::moveWorkspaceToMonitor(CWorkspace* pWorkspace, CMonitor* pMoni
     g_pInputManager->refocus();
 
     // event
-    g_pEventManager->postEvent(SHyprIPCEvent{"moveworkspace", pWorkspace->m_szName + "," + pMonitor->szName});
+    g_pEventManager->postEvent(SHyprIPCEvent{"moveworkspace", pWorkspace->m_szName + "," + pMonitor->szName, pMonitor->szName, pWorkspace->m_szName});
     EMIT_HOOK_EVENT("moveWorkspace", (std::vector<void*>{pWorkspace, pMonitor}));
 }
 
@@ -2047,47 +2052,36 @@ void CCompositor::scheduleFrameForMonitor(CMonitor* pMonitor) {
 }
 
 CWindow* CCompositor::getWindowByRegex(const std::string& regexp) {
-    eFocusWindowMode mode = MODE_CLASS_REGEX;
-
-    std::regex       regexCheck(regexp);
-    std::string      matchCheck;
-    if (regexp.find("title:") == 0) {
-        mode       = MODE_TITLE_REGEX;
-        regexCheck = std::regex(regexp.substr(6));
-    } else if (regexp.find("address:") == 0) {
-        mode       = MODE_ADDRESS;
-        matchCheck = regexp.substr(8);
-    } else if (regexp.find("pid:") == 0) {
-        mode       = MODE_PID;
-        matchCheck = regexp.substr(4);
-    }
+    return getWindowBySelector(parseWindowSelector(regexp));
+}
 
+CWindow* CCompositor::getWindowBySelector(const SWindowSelector& selector) {
     for (auto& w : g_pCompositor->m_vWindows) {
         if (!w->m_bIsMapped || (w->isHidden() && !w->m_sGroupData.pNextWindow))
             continue;
 
-        switch (mode) {
+        switch (selector.mode) {
             case MODE_CLASS_REGEX: {
                 const auto windowClass = g_pXWaylandManager->getAppIDClass(w.get());
-                if (!std::regex_search(g_pXWaylandManager->getAppIDClass(w.get()), regexCheck))
+                if (!std::regex_search(windowClass, selector.regex))
                     continue;
                 break;
             }
             case MODE_TITLE_REGEX: {
                 const auto windowTitle = g_pXWaylandManager->getTitle(w.get());
-                if (!std::regex_search(windowTitle, regexCheck))
+                if (!std::regex_search(windowTitle, selector.regex))
                     continue;
                 break;
             }
             case MODE_ADDRESS: {
                 std::string addr = getFormat("0x%x", w.get());
-                if (matchCheck != addr)
+                if (selector.match != addr)
                     continue;
                 break;
             }
             case MODE_PID: {
                 std::string pid = getFormat("%d", w->getPID());
-                if (matchCheck != pid)
+                if (selector.match != pid)
                     continue;
                 break;
             }
@@ -2105,7 +2099,7 @@ void CCompositor::warpCursorTo(const Vector2D& pos, bool force) {
     // warpCursorTo should only be used for warps that
     // should be disabled with no_cursor_warps
 
-    static auto* const PNOWARPS = &g_pConfigManager->getConfigValuePtr("general:no_cursor_warps")->intValue;
+    static auto* const PNOWARPS = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_NO_CURSOR_WARPS)->intValue;
 
     if (*PNOWARPS && !force)
         return;
@@ -2171,41 +2165,7 @@ SLayerSurface* CCompositor::getLayerSurfaceFromSurface(wlr_surface* pSurface) {
 
 // returns a delta
 Vector2D CCompositor::parseWindowVectorArgsRelative(const std::string& args, const Vector2D& relativeTo) {
-    if (!args.contains(' '))
-        return relativeTo;
-
-    std::string x = args.substr(0, args.find_first_of(' '));
-    std::string y = args.substr(args.find_first_of(' ') + 1);
-
-    if (x == "exact") {
-        std::string newX = y.substr(0, y.find_first_of(' '));
-        std::string newY = y.substr(y.find_first_of(' ') + 1);
-
-        if (!isNumber(newX) || !isNumber(newY)) {
-            Debug::log(ERR, "parseWindowVectorArgsRelative: exact args not numbers");
-            return relativeTo;
-        }
-
-        const int X = std::stoi(newX);
-        const int Y = std::stoi(newY);
-
-        if (X < 0 || Y < 0) {
-            Debug::log(ERR, "parseWindowVectorArgsRelative: exact args cannot be < 0");
-            return relativeTo;
-        }
-
-        return Vector2D(X, Y);
-    }
-
-    if (!isNumber(x) || !isNumber(y)) {
-        Debug::log(ERR, "parseWindowVectorArgsRelative: args not numbers");
-        return relativeTo;
-    }
-
-    const int X = std::stoi(x);
-    const int Y = std::stoi(y);
-
-    return Vector2D(X + relativeTo.x, Y + relativeTo.y);
+    return applyWindowVector(parseWindowVector(args), relativeTo);
 }
 
 void CCompositor::forceReportSizesToWindowsOnWorkspace(const int& wid) {
@@ -2275,7 +2235,7 @@ void CCompositor::setActiveMonitor(CMonitor* pMonitor) {
 
     const auto PWORKSPACE = getWorkspaceByID(pMonitor->activeWorkspace);
 
-    g_pEventManager->postEvent(SHyprIPCEvent{"focusedmon", pMonitor->szName + "," + PWORKSPACE->m_szName});
+    g_pEventManager->postEvent(SHyprIPCEvent{"focusedmon", pMonitor->szName + "," + PWORKSPACE->m_szName, pMonitor->szName, PWORKSPACE->m_szName});
     EMIT_HOOK_EVENT("focusedMon", pMonitor);
     m_pLastMonitor = pMonitor;
 }
@@ -2298,7 +2258,7 @@ int CCompositor::getNewSpecialID() {
 void CCompositor::performUserChecks() {
     static constexpr auto BAD_PORTALS = {"kde", "gnome"};
 
-    static auto* const    PSUPPRESSPORTAL = &g_pConfigManager->getConfigValuePtr("misc:suppress_portal_warnings")->intValue;
+    static auto* const    PSUPPRESSPORTAL = &g_pConfigManager->getConfigValuePtr(CFG_MISC_SUPPRESS_PORTAL_WARNINGS)->intValue;
 
     if (!*PSUPPRESSPORTAL) {
         if (std::ranges::any_of(BAD_PORTALS, [&](const std::string& portal) { return std::filesystem::exists("/usr/share/xdg-desktop-portal/portals/" + portal + ".portal"); })) {
@@ -2313,3 +2273,53 @@ void CCompositor::performUserChecks() {
         }
     }
 }
+
+void CCompositor::beginTransaction() {
+    m_sTransaction.depth++;
+}
+
+void CCompositor::commitTransaction() {
+    if (m_sTransaction.depth <= 0 || --m_sTransaction.depth > 0)
+        return;
+
+    // take it out first, everything below runs with deferring off
+    const auto TRANSACTION = std::move(m_sTransaction);
+    m_sTransaction         = {};
+
+    if (TRANSACTION.reloadMonitors)
+        g_pConfigManager->performMonitorReload();
+
+    if (TRANSACTION.updateInputConfigs) {
+        g_pInputManager->setKeyboardLayout();
+        g_pInputManager->setPointerConfigs();
+        g_pInputManager->setTouchDeviceConfigs();
+        g_pInputManager->setTabletConfigs();
+    }
+
+    for (auto& id : TRANSACTION.recalculateMonitors)
+        g_pLayoutManager->getCurrentLayout()->recalculateMonitor(id);
+
+    if (TRANSACTION.updateDecorations)
+        updateAllWindowsAnimatedDecorationValues();
+
+    for (auto& id : TRANSACTION.damageMonitors) {
+        if (const auto PMONITOR = getMonitorFromID(id); PMONITOR)
+            g_pHyprRenderer->damageMonitor(PMONITOR);
+    }
+}
+
+bool CCompositor::deferMonitorRecalculation(const int& monid) {
+    if (m_sTransaction.depth <= 0)
+        return false;
+
+    m_sTransaction.recalculateMonitors.insert(monid);
+    return true;
+}
+
+bool CCompositor::deferMonitorDamage(CMonitor* pMonitor) {
+    if (m_sTransaction.depth <= 0)
+        return false;
+
+    m_sTransaction.damageMonitors.insert(pMonitor->ID);
+    return true;
+}
@@ -3,9 +3,11 @@
 #include <memory>
 #include <deque>
 #include <list>
+#include <unordered_set>
 
 #include "defines.hpp"
 #include "debug/Log.hpp"
+#include "helpers/DispatcherArgs.hpp"
 #include "events/Events.hpp"
 #include "config/ConfigManager.hpp"
 #include "managers/ThreadManager.hpp"
@@ -20,6 +22,8 @@
 #include "managers/HookSystemManager.hpp"
 #include "debug/HyprDebugOverlay.hpp"
 #include "debug/HyprNotificationOverlay.hpp"
+#include "debug/HyprCtlSnapshot.hpp"
+#include "debug/Tracing.hpp"
 #include "helpers/Monitor.hpp"
 #include "helpers/Workspace.hpp"
 #include "Window.hpp"
@@ -28,6 +32,16 @@
 #include "hyprerror/HyprError.hpp"
 #include "plugins/PluginSystem.hpp"
 
+// work that every command of a hyprctl batch would redo, collected and applied once on commit
+struct SStateTransaction {
+    int                     depth = 0;
+    std::unordered_set<int> recalculateMonitors;
+    std::unordered_set<int> damageMonitors;
+    bool                    reloadMonitors     = false;
+    bool                    updateDecorations  = false;
+    bool                    updateInputConfigs = false;
+};
+
 enum eManagersInitStage {
     STAGE_PRIORITY = 0,
     STAGE_LATE
@@ -116,6 +130,8 @@ class CCompositor {
     bool                                      m_bUnsafeState    = false; // unsafe state is when there is no monitors.
     bool                                      m_bIsShuttingDown = false;
 
+    SStateTransaction                         m_sTransaction;
+
     // ------------------------------------------------- //
 
     CMonitor*      getMonitorFromID(const int&);
@@ -175,6 +191,7 @@ class CCompositor {
     void           addToFadingOutSafe(SLayerSurface*);
     void           addToFadingOutSafe(CWindow*);
     CWindow*       getWindowByRegex(const std::string&);
+    CWindow*       getWindowBySelector(const SWindowSelector&);
     void           warpCursorTo(const Vector2D&, bool force = false);
     SLayerSurface* getLayerSurfaceFromWlr(wlr_layer_surface_v1*);
     SLayerSurface* getLayerSurfaceFromSurface(wlr_surface*);
@@ -188,6 +205,10 @@ class CCompositor {
     bool           isWorkspaceSpecial(const int&);
     int            getNewSpecialID();
     void           performUserChecks();
+    void           beginTransaction();
+    void           commitTransaction();
+    bool           deferMonitorRecalculation(const int&); // true if inside a transaction, recalculated on commit
+    bool           deferMonitorDamage(CMonitor*);         // true if inside a transaction, damaged on commit
 
     std::string    explicitConfigPath;
 
@@ -23,7 +23,7 @@ CWindow::~CWindow() {
 }
 
 wlr_box CWindow::getFullWindowBoundingBox() {
-    static auto* const PBORDERSIZE = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
+    static auto* const PBORDERSIZE = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
 
     if (m_sAdditionalConfigData.dimAround) {
         const auto PMONITOR = g_pCompositor->getMonitorFromID(m_iMonitorID);
@@ -89,7 +89,7 @@ wlr_box CWindow::getWindowIdealBoundingBoxIgnoreReserved() {
 }
 
 wlr_box CWindow::getWindowInputBox() {
-    static auto* const PBORDERSIZE = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
+    static auto* const PBORDERSIZE = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
 
     if (m_sAdditionalConfigData.dimAround) {
         const auto PMONITOR = g_pCompositor->getMonitorFromID(m_iMonitorID);
@@ -280,7 +280,7 @@ void CWindow::moveToWorkspace(int workspaceID) {
     const auto PWORKSPACE = g_pCompositor->getWorkspaceByID(m_iWorkspaceID);
 
     if (PWORKSPACE) {
-        g_pEventManager->postEvent(SHyprIPCEvent{"movewindow", getFormat("%x,%s", this, PWORKSPACE->m_szName.c_str())});
+        g_pEventManager->postEvent(windowIPCEvent("movewindow", getFormat("%x,%s", this, PWORKSPACE->m_szName.c_str()), this));
         EMIT_HOOK_EVENT("moveWindow", (std::vector<void*>{this, PWORKSPACE}));
     }
 
@@ -493,8 +493,8 @@ void CWindow::updateDynamicRules() {
 // it is assumed that the point is within the real window box (m_vRealPosition, m_vRealSize)
 // otherwise behaviour is undefined
 bool CWindow::isInCurvedCorner(double x, double y) {
-    static auto* const ROUNDING   = &g_pConfigManager->getConfigValuePtr("decoration:rounding")->intValue;
-    static auto* const BORDERSIZE = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
+    static auto* const ROUNDING   = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ROUNDING)->intValue;
+    static auto* const BORDERSIZE = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
 
     if (BORDERSIZE >= ROUNDING || ROUNDING == 0)
         return false;
@@ -133,6 +133,8 @@ struct SWindowRule {
     int         bFloating   = -1;
     int         bFullscreen = -1;
     int         bPinned     = -1;
+
+    bool        operator==(const SWindowRule&) const = default;
 };
 
 class CWindow {
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Every static config value, declared once as X(ID, name, type, default).
+// The defaults are applied by CConfigManager::setDefaultVars, the IDs index its flat value array.
+// Plugin and per-device values are dynamic and stay string-keyed.
+#define CONFIG_KEYS(X)                                                                                                            \
+    X(GENERAL_MAX_FPS,                             "general:max_fps",                             INT,      60)                   \
+    X(GENERAL_SENSITIVITY,                         "general:sensitivity",                         FLOAT,    1.0f)                 \
+    X(GENERAL_APPLY_SENS_TO_RAW,                   "general:apply_sens_to_raw",                   INT,      0)                    \
+    X(GENERAL_BORDER_SIZE,                         "general:border_size",                         INT,      1)                    \
+    X(GENERAL_NO_BORDER_ON_FLOATING,               "general:no_border_on_floating",               INT,      0)                    \
+    X(GENERAL_GAPS_IN,                             "general:gaps_in",                             INT,      5)                    \
+    X(GENERAL_GAPS_OUT,                            "general:gaps_out",                            INT,      20)                   \
+    X(GENERAL_COL_ACTIVE_BORDER,                   "general:col.active_border",                   GRADIENT, 0xffffffff)           \
+    X(GENERAL_COL_INACTIVE_BORDER,                 "general:col.inactive_border",                 GRADIENT, 0xff444444)           \
+    X(GENERAL_COL_GROUP_BORDER,                    "general:col.group_border",                    GRADIENT, 0x66777700)           \
+    X(GENERAL_COL_GROUP_BORDER_ACTIVE,             "general:col.group_border_active",             GRADIENT, 0x66ffff00)           \
+    X(GENERAL_CURSOR_INACTIVE_TIMEOUT,             "general:cursor_inactive_timeout",             INT,      0)                    \
+    X(GENERAL_NO_CURSOR_WARPS,                     "general:no_cursor_warps",                     INT,      0)                    \
+    X(GENERAL_RESIZE_ON_BORDER,                    "general:resize_on_border",                    INT,      0)                    \
+    X(GENERAL_EXTEND_BORDER_GRAB_AREA,             "general:extend_border_grab_area",             INT,      15)                   \
+    X(GENERAL_HOVER_ICON_ON_BORDER,                "general:hover_icon_on_border",                INT,      1)                    \
+    X(GENERAL_LAYOUT,                              "general:layout",                              STRING,   "dwindle")            \
+    X(MISC_DISABLE_HYPRLAND_LOGO,                  "misc:disable_hyprland_logo",                  INT,      0)                    \
+    X(MISC_DISABLE_SPLASH_RENDERING,               "misc:disable_splash_rendering",               INT,      0)                    \
+    X(MISC_VFR,                                    "misc:vfr",                                    INT,      1)                    \
+    X(MISC_VRR,                                    "misc:vrr",                                    INT,      0)                    \
+    X(MISC_MOUSE_MOVE_ENABLES_DPMS,                "misc:mouse_move_enables_dpms",                INT,      0)                    \
+    X(MISC_KEY_PRESS_ENABLES_DPMS,                 "misc:key_press_enables_dpms",                 INT,      0)                    \
+    X(MISC_ALWAYS_FOLLOW_ON_DND,                   "misc:always_follow_on_dnd",                   INT,      1)                    \
+    X(MISC_LAYERS_HOG_KEYBOARD_FOCUS,              "misc:layers_hog_keyboard_focus",              INT,      1)                    \
+    X(MISC_ANIMATE_MANUAL_RESIZES,                 "misc:animate_manual_resizes",                 INT,      0)                    \
+    X(MISC_ANIMATE_MOUSE_WINDOWDRAGGING,           "misc:animate_mouse_windowdragging",           INT,      0)                    \
+    X(MISC_DISABLE_AUTORELOAD,                     "misc:disable_autoreload",                     INT,      0)                    \
+    X(MISC_ENABLE_SWALLOW,                         "misc:enable_swallow",                         INT,      0)                    \
+    X(MISC_SWALLOW_REGEX,                          "misc:swallow_regex",                          STRING,   STRVAL_EMPTY)         \
+    X(MISC_FOCUS_ON_ACTIVATE,                      "misc:focus_on_activate",                      INT,      0)                    \
+    X(MISC_NO_DIRECT_SCANOUT,                      "misc:no_direct_scanout",                      INT,      1)                    \
+    X(MISC_HIDE_CURSOR_ON_TOUCH,                   "misc:hide_cursor_on_touch",                   INT,      1)                    \
+    X(MISC_MOUSE_MOVE_FOCUSES_MONITOR,             "misc:mouse_move_focuses_monitor",             INT,      1)                    \
+    X(MISC_SUPPRESS_PORTAL_WARNINGS,               "misc:suppress_portal_warnings",               INT,      0)                    \
+    X(MISC_RENDER_AHEAD_OF_TIME,                   "misc:render_ahead_of_time",                   INT,      0)                    \
+    X(MISC_RENDER_AHEAD_SAFEZONE,                  "misc:render_ahead_safezone",                  INT,      1)                    \
+    X(MISC_CACHE_CONFIG,                           "misc:cache_config",                           INT,      0)                    \
+    X(DEBUG_INT,                                   "debug:int",                                   INT,      0)                    \
+    X(DEBUG_LOG_DAMAGE,                            "debug:log_damage",                            INT,      0)                    \
+    X(DEBUG_OVERLAY,                               "debug:overlay",                               INT,      0)                    \
+    X(DEBUG_GPU_TIMERS,                            "debug:gpu_timers",                            INT,      0)                    \
+    X(DEBUG_DAMAGE_BLINK,                          "debug:damage_blink",                          INT,      0)                    \
+    X(DEBUG_DISABLE_LOGS,                          "debug:disable_logs",                          INT,      0)                    \
+    X(DEBUG_LOG_LEVEL,                             "debug:log_level",                             INT,      0)                    \
+    X(DEBUG_DISABLE_TIME,                          "debug:disable_time",                          INT,      1)                    \
+    X(DEBUG_ENABLE_STDOUT_LOGS,                    "debug:enable_stdout_logs",                    INT,      0)                    \
+    X(DEBUG_DAMAGE_TRACKING,                       "debug:damage_tracking",                       INT,      DAMAGE_TRACKING_FULL) \
+    X(DEBUG_MANUAL_CRASH,                          "debug:manual_crash",                          INT,      0)                    \
+    X(DECORATION_ROUNDING,                         "decoration:rounding",                         INT,      0)                    \
+    X(DECORATION_BLUR,                             "decoration:blur",                             INT,      1)                    \
+    X(DECORATION_BLUR_SIZE,                        "decoration:blur_size",                        INT,      8)                    \
+    X(DECORATION_BLUR_PASSES,                      "decoration:blur_passes",                      INT,      1)                    \
+    X(DECORATION_BLUR_IGNORE_OPACITY,              "decoration:blur_ignore_opacity",              INT,      0)                    \
+    X(DECORATION_BLUR_NEW_OPTIMIZATIONS,           "decoration:blur_new_optimizations",           INT,      1)                    \
+    X(DECORATION_BLUR_XRAY,                        "decoration:blur_xray",                        INT,      0)                    \
+    X(DECORATION_ACTIVE_OPACITY,                   "decoration:active_opacity",                   FLOAT,    1)                    \
+    X(DECORATION_INACTIVE_OPACITY,                 "decoration:inactive_opacity",                 FLOAT,    1)                    \
+    X(DECORATION_FULLSCREEN_OPACITY,               "decoration:fullscreen_opacity",               FLOAT,    1)                    \
+    X(DECORATION_MULTISAMPLE_EDGES,                "decoration:multisample_edges",                INT,      1)                    \
+    X(DECORATION_NO_BLUR_ON_OVERSIZED,             "decoration:no_blur_on_oversized",             INT,      0)                    \
+    X(DECORATION_DROP_SHADOW,                      "decoration:drop_shadow",                      INT,      1)                    \
+    X(DECORATION_SHADOW_RANGE,                     "decoration:shadow_range",                     INT,      4)                    \
+    X(DECORATION_SHADOW_RENDER_POWER,              "decoration:shadow_render_power",              INT,      3)                    \
+    X(DECORATION_SHADOW_IGNORE_WINDOW,             "decoration:shadow_ignore_window",             INT,      1)                    \
+    X(DECORATION_SHADOW_OFFSET,                    "decoration:shadow_offset",                    VECTOR,   Vector2D())           \
+    X(DECORATION_SHADOW_SCALE,                     "decoration:shadow_scale",                     FLOAT,    1.f)                  \
+    X(DECORATION_COL_SHADOW,                       "decoration:col.shadow",                       INT,      0xee1a1a1a)           \
+    X(DECORATION_COL_SHADOW_INACTIVE,              "decoration:col.shadow_inactive",              INT,      INT_MAX)              \
+    X(DECORATION_DIM_INACTIVE,                     "decoration:dim_inactive",                     INT,      0)                    \
+    X(DECORATION_DIM_STRENGTH,                     "decoration:dim_strength",                     FLOAT,    0.5f)                 \
+    X(DECORATION_DIM_SPECIAL,                      "decoration:dim_special",                      FLOAT,    0.2f)                 \
+    X(DECORATION_DIM_AROUND,                       "decoration:dim_around",                       FLOAT,    0.4f)                 \
+    X(DECORATION_SCREEN_SHADER,                    "decoration:screen_shader",                    STRING,   STRVAL_EMPTY)         \
+    X(DWINDLE_PSEUDOTILE,                          "dwindle:pseudotile",                          INT,      0)                    \
+    X(DWINDLE_FORCE_SPLIT,                         "dwindle:force_split",                         INT,      0)                    \
+    X(DWINDLE_PRESERVE_SPLIT,                      "dwindle:preserve_split",                      INT,      0)                    \
+    X(DWINDLE_SPECIAL_SCALE_FACTOR,                "dwindle:special_scale_factor",                FLOAT,    0.8f)                 \
+    X(DWINDLE_SPLIT_WIDTH_MULTIPLIER,              "dwindle:split_width_multiplier",              FLOAT,    1.0f)                 \
+    X(DWINDLE_NO_GAPS_WHEN_ONLY,                   "dwindle:no_gaps_when_only",                   INT,      0)                    \
+    X(DWINDLE_USE_ACTIVE_FOR_SPLITS,               "dwindle:use_active_for_splits",               INT,      1)                    \
+    X(DWINDLE_DEFAULT_SPLIT_RATIO,                 "dwindle:default_split_ratio",                 FLOAT,    1.f)                  \
+    X(MASTER_SPECIAL_SCALE_FACTOR,                 "master:special_scale_factor",                 FLOAT,    0.8f)                 \
+    X(MASTER_MFACT,                                "master:mfact",                                FLOAT,    0.55f)                \
+    X(MASTER_NEW_IS_MASTER,                        "master:new_is_master",                        INT,      1)                    \
+    X(MASTER_ALWAYS_CENTER_MASTER,                 "master:always_center_master",                 INT,      0)                    \
+    X(MASTER_NEW_ON_TOP,                           "master:new_on_top",                           INT,      0)                    \
+    X(MASTER_NO_GAPS_WHEN_ONLY,                    "master:no_gaps_when_only",                    INT,      0)                    \
+    X(MASTER_ORIENTATION,                          "master:orientation",                          STRING,   "left")               \
+    X(MASTER_INHERIT_FULLSCREEN,                   "master:inherit_fullscreen",                   INT,      1)                    \
+    X(ANIMATIONS_ENABLED,                          "animations:enabled",                          INT,      1)                    \
+    X(INPUT_FOLLOW_MOUSE,                          "input:follow_mouse",                          INT,      1)                    \
+    X(INPUT_SENSITIVITY,                           "input:sensitivity",                           FLOAT,    0.f)                  \
+    X(INPUT_ACCEL_PROFILE,                         "input:accel_profile",                         STRING,   STRVAL_EMPTY)         \
+    X(INPUT_KB_FILE,                               "input:kb_file",                               STRING,   STRVAL_EMPTY)         \
+    X(INPUT_KB_LAYOUT,                             "input:kb_layout",                             STRING,   "us")                 \
+    X(INPUT_KB_VARIANT,                            "input:kb_variant",                            STRING,   STRVAL_EMPTY)         \
+    X(INPUT_KB_OPTIONS,                            "input:kb_options",                            STRING,   STRVAL_EMPTY)         \
+    X(INPUT_KB_RULES,                              "input:kb_rules",                              STRING,   STRVAL_EMPTY)         \
+    X(INPUT_KB_MODEL,                              "input:kb_model",                              STRING,   STRVAL_EMPTY)         \
+    X(INPUT_REPEAT_RATE,                           "input:repeat_rate",                           INT,      25)                   \
+    X(INPUT_REPEAT_DELAY,                          "input:repeat_delay",                          INT,      600)                  \
+    X(INPUT_NATURAL_SCROLL,                        "input:natural_scroll",                        INT,      0)                    \
+    X(INPUT_NUMLOCK_BY_DEFAULT,                    "input:numlock_by_default",                    INT,      0)                    \
+    X(INPUT_FORCE_NO_ACCEL,                        "input:force_no_accel",                        INT,      0)                    \
+    X(INPUT_FLOAT_SWITCH_OVERRIDE_FOCUS,           "input:float_switch_override_focus",           INT,      1)                    \
+    X(INPUT_COALESCE_MOTION,                       "input:coalesce_motion",                       INT,      0)                    \
+    X(INPUT_LEFT_HANDED,                           "input:left_handed",                           INT,      0)                    \
+    X(INPUT_SCROLL_METHOD,                         "input:scroll_method",                         STRING,   STRVAL_EMPTY)         \
+    X(INPUT_SCROLL_BUTTON,                         "input:scroll_button",                         INT,      0)                    \
+    X(INPUT_TOUCHPAD_NATURAL_SCROLL,               "input:touchpad:natural_scroll",               INT,      0)                    \
+    X(INPUT_TOUCHPAD_DISABLE_WHILE_TYPING,         "input:touchpad:disable_while_typing",         INT,      1)                    \
+    X(INPUT_TOUCHPAD_CLICKFINGER_BEHAVIOR,         "input:touchpad:clickfinger_behavior",         INT,      0)                    \
+    X(INPUT_TOUCHPAD_TAP_BUTTON_MAP,               "input:touchpad:tap_button_map",               STRING,   STRVAL_EMPTY)         \
+    X(INPUT_TOUCHPAD_MIDDLE_BUTTON_EMULATION,      "input:touchpad:middle_button_emulation",      INT,      0)                    \
+    X(INPUT_TOUCHPAD_TAP_TO_CLICK,                 "input:touchpad:tap-to-click",                 INT,      1)                    \
+    X(INPUT_TOUCHPAD_TAP_AND_DRAG,                 "input:touchpad:tap-and-drag",                 INT,      1)                    \
+    X(INPUT_TOUCHPAD_DRAG_LOCK,                    "input:touchpad:drag_lock",                    INT,      0)                    \
+    X(INPUT_TOUCHPAD_SCROLL_FACTOR,                "input:touchpad:scroll_factor",                FLOAT,    1.f)                  \
+    X(INPUT_TOUCHDEVICE_TRANSFORM,                 "input:touchdevice:transform",                 INT,      0)                    \
+    X(INPUT_TOUCHDEVICE_OUTPUT,                    "input:touchdevice:output",                    STRING,   STRVAL_EMPTY)         \
+    X(INPUT_TABLET_TRANSFORM,                      "input:tablet:transform",                      INT,      0)                    \
+    X(INPUT_TABLET_OUTPUT,                         "input:tablet:output",                         STRING,   STRVAL_EMPTY)         \
+    X(BINDS_PASS_MOUSE_WHEN_BOUND,                 "binds:pass_mouse_when_bound",                 INT,      0)                    \
+    X(BINDS_SCROLL_EVENT_DELAY,                    "binds:scroll_event_delay",                    INT,      300)                  \
+    X(BINDS_WORKSPACE_BACK_AND_FORTH,              "binds:workspace_back_and_forth",              INT,      0)                    \
+    X(BINDS_ALLOW_WORKSPACE_CYCLES,                "binds:allow_workspace_cycles",                INT,      0)                    \
+    X(BINDS_FOCUS_PREFERRED_METHOD,                "binds:focus_preferred_method",                INT,      0)                    \
+    X(GESTURES_WORKSPACE_SWIPE,                    "gestures:workspace_swipe",                    INT,      0)                    \
+    X(GESTURES_WORKSPACE_SWIPE_FINGERS,            "gestures:workspace_swipe_fingers",            INT,      3)                    \
+    X(GESTURES_WORKSPACE_SWIPE_DISTANCE,           "gestures:workspace_swipe_distance",           INT,      300)                  \
+    X(GESTURES_WORKSPACE_SWIPE_INVERT,             "gestures:workspace_swipe_invert",             INT,      1)                    \
+    X(GESTURES_WORKSPACE_SWIPE_MIN_SPEED_TO_FORCE, "gestures:workspace_swipe_min_speed_to_force", INT,      30)                   \
+    X(GESTURES_WORKSPACE_SWIPE_CANCEL_RATIO,       "gestures:workspace_swipe_cancel_ratio",       FLOAT,    0.5f)                 \
+    X(GESTURES_WORKSPACE_SWIPE_CREATE_NEW,         "gestures:workspace_swipe_create_new",         INT,      1)                    \
+    X(GESTURES_WORKSPACE_SWIPE_FOREVER,            "gestures:workspace_swipe_forever",            INT,      0)                    \
+    X(GESTURES_WORKSPACE_SWIPE_NUMBERED,           "gestures:workspace_swipe_numbered",           INT,      0)                    \
+    X(AUTOGENERATED,                               "autogenerated",                               INT,      0)
+
+enum eConfigValueType : uint8_t
+{
+    CONFIG_TYPE_INT = 0,
+    CONFIG_TYPE_FLOAT,
+    CONFIG_TYPE_STRING,
+    CONFIG_TYPE_VECTOR,
+    CONFIG_TYPE_GRADIENT
+};
+
+enum eConfigKey : uint16_t
+{
+#define CONFIG_KEY_ENUM(id, name, type, def) CFG_##id,
+    CONFIG_KEYS(CONFIG_KEY_ENUM)
+#undef CONFIG_KEY_ENUM
+
+    CFG_KEYS_COUNT
+};
+
+struct SConfigKeyInfo {
+    const char*      name;
+    eConfigValueType type;
+};
+
+inline constexpr std::array<SConfigKeyInfo, CFG_KEYS_COUNT> CONFIG_KEY_INFO = {{
+#define CONFIG_KEY_INFO_ENTRY(id, name, type, def) {name, CONFIG_TYPE_##type},
+    CONFIG_KEYS(CONFIG_KEY_INFO_ENTRY)
+#undef CONFIG_KEY_INFO_ENTRY
+}};
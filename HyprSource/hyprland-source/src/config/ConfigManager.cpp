@@ -2,21 +2,26 @@
 #include "../managers/KeybindManager.hpp"
 
 #include <string.h>
+#include <sys/inotify.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
 extern "C" char** environ;
 
 CConfigManager::CConfigManager() {
-    configValues["general:col.active_border"].data       = std::make_shared<CGradientValueData>(0xffffffff);
-    configValues["general:col.inactive_border"].data     = std::make_shared<CGradientValueData>(0xff444444);
-    configValues["general:col.group_border"].data        = std::make_shared<CGradientValueData>(0x66777700);
-    configValues["general:col.group_border_active"].data = std::make_shared<CGradientValueData>(0x66ffff00);
+    for (size_t i = 0; i < CFG_KEYS_COUNT; ++i) {
+        configKeyIndex[CONFIG_KEY_INFO[i].name] = (eConfigKey)i;
+
+        // the actual default color is set by setDefaultVars
+        if (CONFIG_KEY_INFO[i].type == CONFIG_TYPE_GRADIENT)
+            configValues[i].data = std::make_shared<CGradientValueData>(0xffffffff);
+    }
 
     setDefaultVars();
     setDefaultAnimationVars();
@@ -31,8 +36,9 @@ CConfigManager::CConfigManager() {
 
     configPaths.emplace_back(CONFIGPATH);
 
-    Debug::disableLogs = &configValues["debug:disable_logs"].intValue;
-    Debug::disableTime = &configValues["debug:disable_time"].intValue;
+    Debug::disableLogs = &configValues[CFG_DEBUG_DISABLE_LOGS].intValue;
+    Debug::disableTime = &configValues[CFG_DEBUG_DISABLE_TIME].intValue;
+    Debug::minLevel    = &configValues[CFG_DEBUG_LOG_LEVEL].intValue;
 
     populateEnvironment();
 }
@@ -50,150 +56,22 @@ void CConfigManager::populateEnvironment() {
 }
 
 void CConfigManager::setDefaultVars() {
-    configValues["general:max_fps"].intValue               = 60;
-    configValues["general:sensitivity"].floatValue         = 1.0f;
-    configValues["general:apply_sens_to_raw"].intValue     = 0;
-    configValues["general:border_size"].intValue           = 1;
-    configValues["general:no_border_on_floating"].intValue = 0;
-    configValues["general:gaps_in"].intValue               = 5;
-    configValues["general:gaps_out"].intValue              = 20;
-    ((CGradientValueData*)configValues["general:col.active_border"].data.get())->reset(0xffffffff);
-    ((CGradientValueData*)configValues["general:col.inactive_border"].data.get())->reset(0xff444444);
-    ((CGradientValueData*)configValues["general:col.group_border"].data.get())->reset(0x66777700);
-    ((CGradientValueData*)configValues["general:col.group_border_active"].data.get())->reset(0x66ffff00);
-    configValues["general:cursor_inactive_timeout"].intValue = 0;
-    configValues["general:no_cursor_warps"].intValue         = 0;
-    configValues["general:resize_on_border"].intValue        = 0;
-    configValues["general:extend_border_grab_area"].intValue = 15;
-    configValues["general:hover_icon_on_border"].intValue    = 1;
-    configValues["general:layout"].strValue                  = "dwindle";
-
-    configValues["misc:disable_hyprland_logo"].intValue        = 0;
-    configValues["misc:disable_splash_rendering"].intValue     = 0;
-    configValues["misc:vfr"].intValue                          = 1;
-    configValues["misc:vrr"].intValue                          = 0;
-    configValues["misc:mouse_move_enables_dpms"].intValue      = 0;
-    configValues["misc:key_press_enables_dpms"].intValue       = 0;
-    configValues["misc:always_follow_on_dnd"].intValue         = 1;
-    configValues["misc:layers_hog_keyboard_focus"].intValue    = 1;
-    configValues["misc:animate_manual_resizes"].intValue       = 0;
-    configValues["misc:animate_mouse_windowdragging"].intValue = 0;
-    configValues["misc:disable_autoreload"].intValue           = 0;
-    configValues["misc:enable_swallow"].intValue               = 0;
-    configValues["misc:swallow_regex"].strValue                = STRVAL_EMPTY;
-    configValues["misc:focus_on_activate"].intValue            = 0;
-    configValues["misc:no_direct_scanout"].intValue            = 1;
-    configValues["misc:hide_cursor_on_touch"].intValue         = 1;
-    configValues["misc:mouse_move_focuses_monitor"].intValue   = 1;
-    configValues["misc:suppress_portal_warnings"].intValue     = 0;
-    configValues["misc:render_ahead_of_time"].intValue         = 0;
-    configValues["misc:render_ahead_safezone"].intValue        = 1;
-
-    configValues["debug:int"].intValue                = 0;
-    configValues["debug:log_damage"].intValue         = 0;
-    configValues["debug:overlay"].intValue            = 0;
-    configValues["debug:damage_blink"].intValue       = 0;
-    configValues["debug:disable_logs"].intValue       = 0;
-    configValues["debug:disable_time"].intValue       = 1;
-    configValues["debug:enable_stdout_logs"].intValue = 0;
-    configValues["debug:damage_tracking"].intValue    = DAMAGE_TRACKING_FULL;
-    configValues["debug:manual_crash"].intValue       = 0;
-
-    configValues["decoration:rounding"].intValue               = 0;
-    configValues["decoration:blur"].intValue                   = 1;
-    configValues["decoration:blur_size"].intValue              = 8;
-    configValues["decoration:blur_passes"].intValue            = 1;
-    configValues["decoration:blur_ignore_opacity"].intValue    = 0;
-    configValues["decoration:blur_new_optimizations"].intValue = 1;
-    configValues["decoration:blur_xray"].intValue              = 0;
-    configValues["decoration:active_opacity"].floatValue       = 1;
-    configValues["decoration:inactive_opacity"].floatValue     = 1;
-    configValues["decoration:fullscreen_opacity"].floatValue   = 1;
-    configValues["decoration:multisample_edges"].intValue      = 1;
-    configValues["decoration:no_blur_on_oversized"].intValue   = 0;
-    configValues["decoration:drop_shadow"].intValue            = 1;
-    configValues["decoration:shadow_range"].intValue           = 4;
-    configValues["decoration:shadow_render_power"].intValue    = 3;
-    configValues["decoration:shadow_ignore_window"].intValue   = 1;
-    configValues["decoration:shadow_offset"].vecValue          = Vector2D();
-    configValues["decoration:shadow_scale"].floatValue         = 1.f;
-    configValues["decoration:col.shadow"].intValue             = 0xee1a1a1a;
-    configValues["decoration:col.shadow_inactive"].intValue    = INT_MAX;
-    configValues["decoration:dim_inactive"].intValue           = 0;
-    configValues["decoration:dim_strength"].floatValue         = 0.5f;
-    configValues["decoration:dim_special"].floatValue          = 0.2f;
-    configValues["decoration:dim_around"].floatValue           = 0.4f;
-    configValues["decoration:screen_shader"].strValue          = STRVAL_EMPTY;
-
-    configValues["dwindle:pseudotile"].intValue               = 0;
-    configValues["dwindle:force_split"].intValue              = 0;
-    configValues["dwindle:preserve_split"].intValue           = 0;
-    configValues["dwindle:special_scale_factor"].floatValue   = 0.8f;
-    configValues["dwindle:split_width_multiplier"].floatValue = 1.0f;
-    configValues["dwindle:no_gaps_when_only"].intValue        = 0;
-    configValues["dwindle:use_active_for_splits"].intValue    = 1;
-    configValues["dwindle:default_split_ratio"].floatValue    = 1.f;
-
-    configValues["master:special_scale_factor"].floatValue = 0.8f;
-    configValues["master:mfact"].floatValue                = 0.55f;
-    configValues["master:new_is_master"].intValue          = 1;
-    configValues["master:always_center_master"].intValue   = 0;
-    configValues["master:new_on_top"].intValue             = 0;
-    configValues["master:no_gaps_when_only"].intValue      = 0;
-    configValues["master:orientation"].strValue            = "left";
-    configValues["master:inherit_fullscreen"].intValue     = 1;
-
-    configValues["animations:enabled"].intValue = 1;
-
-    configValues["input:follow_mouse"].intValue                     = 1;
-    configValues["input:sensitivity"].floatValue                    = 0.f;
-    configValues["input:accel_profile"].strValue                    = STRVAL_EMPTY;
-    configValues["input:kb_file"].strValue                          = STRVAL_EMPTY;
-    configValues["input:kb_layout"].strValue                        = "us";
-    configValues["input:kb_variant"].strValue                       = STRVAL_EMPTY;
-    configValues["input:kb_options"].strValue                       = STRVAL_EMPTY;
-    configValues["input:kb_rules"].strValue                         = STRVAL_EMPTY;
-    configValues["input:kb_model"].strValue                         = STRVAL_EMPTY;
-    configValues["input:repeat_rate"].intValue                      = 25;
-    configValues["input:repeat_delay"].intValue                     = 600;
-    configValues["input:natural_scroll"].intValue                   = 0;
-    configValues["input:numlock_by_default"].intValue               = 0;
-    configValues["input:force_no_accel"].intValue                   = 0;
-    configValues["input:float_switch_override_focus"].intValue      = 1;
-    configValues["input:left_handed"].intValue                      = 0;
-    configValues["input:scroll_method"].strValue                    = STRVAL_EMPTY;
-    configValues["input:scroll_button"].intValue                    = 0;
-    configValues["input:touchpad:natural_scroll"].intValue          = 0;
-    configValues["input:touchpad:disable_while_typing"].intValue    = 1;
-    configValues["input:touchpad:clickfinger_behavior"].intValue    = 0;
-    configValues["input:touchpad:tap_button_map"].strValue          = STRVAL_EMPTY;
-    configValues["input:touchpad:middle_button_emulation"].intValue = 0;
-    configValues["input:touchpad:tap-to-click"].intValue            = 1;
-    configValues["input:touchpad:tap-and-drag"].intValue            = 1;
-    configValues["input:touchpad:drag_lock"].intValue               = 0;
-    configValues["input:touchpad:scroll_factor"].floatValue         = 1.f;
-    configValues["input:touchdevice:transform"].intValue            = 0;
-    configValues["input:touchdevice:output"].strValue               = STRVAL_EMPTY;
-    configValues["input:tablet:transform"].intValue                 = 0;
-    configValues["input:tablet:output"].strValue                    = STRVAL_EMPTY;
-
-    configValues["binds:pass_mouse_when_bound"].intValue    = 0;
-    configValues["binds:scroll_event_delay"].intValue       = 300;
-    configValues["binds:workspace_back_and_forth"].intValue = 0;
-    configValues["binds:allow_workspace_cycles"].intValue   = 0;
-    configValues["binds:focus_preferred_method"].intValue   = 0;
-
-    configValues["gestures:workspace_swipe"].intValue                    = 0;
-    configValues["gestures:workspace_swipe_fingers"].intValue            = 3;
-    configValues["gestures:workspace_swipe_distance"].intValue           = 300;
-    configValues["gestures:workspace_swipe_invert"].intValue             = 1;
-    configValues["gestures:workspace_swipe_min_speed_to_force"].intValue = 30;
-    configValues["gestures:workspace_swipe_cancel_ratio"].floatValue     = 0.5f;
-    configValues["gestures:workspace_swipe_create_new"].intValue         = 1;
-    configValues["gestures:workspace_swipe_forever"].intValue            = 0;
-    configValues["gestures:workspace_swipe_numbered"].intValue           = 0;
-
-    configValues["autogenerated"].intValue = 0;
+    // defaults live next to the key declarations in ConfigKeys.hpp
+#define CONFIG_DEFAULT_INT(key, def)            configValues[key].intValue = def;
+#define CONFIG_DEFAULT_FLOAT(key, def)          configValues[key].floatValue = def;
+#define CONFIG_DEFAULT_STRING(key, def)         configValues[key].strValue = def;
+#define CONFIG_DEFAULT_VECTOR(key, def)         configValues[key].vecValue = def;
+#define CONFIG_DEFAULT_GRADIENT(key, def)       ((CGradientValueData*)configValues[key].data.get())->reset(def);
+#define CONFIG_KEY_DEFAULT(id, name, type, def) CONFIG_DEFAULT_##type(CFG_##id, def)
+
+    CONFIG_KEYS(CONFIG_KEY_DEFAULT)
+
+#undef CONFIG_KEY_DEFAULT
+#undef CONFIG_DEFAULT_GRADIENT
+#undef CONFIG_DEFAULT_VECTOR
+#undef CONFIG_DEFAULT_STRING
+#undef CONFIG_DEFAULT_FLOAT
+#undef CONFIG_DEFAULT_INT
 }
 
 void CConfigManager::setDeviceDefaultVars(const std::string& dev) {
@@ -277,6 +155,8 @@ void CConfigManager::setDefaultAnimationVars() {
 
 void CConfigManager::init() {
 
+    startConfigWatcher();
+
     loadConfigLoadVars();
 
     const char* const ENVHOME = getenv("HOME");
@@ -295,7 +175,9 @@ void CConfigManager::init() {
 }
 
 void CConfigManager::configSetValueSafe(const std::string& COMMAND, const std::string& VALUE) {
-    if (configValues.find(COMMAND) == configValues.end()) {
+    const auto KEY = findConfigKey(COMMAND);
+
+    if (KEY == CFG_KEYS_COUNT) {
         if (COMMAND.find("device:") != 0 /* devices parsed later */ && COMMAND.find("plugin:") != 0 /* plugins parsed later */) {
             if (COMMAND[0] == '$') {
                 // register a dynamic var
@@ -346,7 +228,7 @@ void CConfigManager::configSetValueSafe(const std::string& COMMAND, const std::s
         if (!CONFIGENTRY)
             return; // silent ignore
     } else {
-        CONFIGENTRY = &configValues.at(COMMAND);
+        CONFIGENTRY = &configValues[KEY];
     }
 
     CONFIGENTRY->set = true;
@@ -445,6 +327,7 @@ void CConfigManager::configSetValueSafe(const std::string& COMMAND, const std::s
         const auto PATH = absolutePath(VALUE, configCurrentPath);
 
         configPaths.push_back(PATH);
+        m_szScreenShaderPath = PATH;
 
         struct stat fileStat;
         int         err = stat(PATH.c_str(), &fileStat);
@@ -458,6 +341,9 @@ void CConfigManager::configSetValueSafe(const std::string& COMMAND, const std::s
 }
 
 void CConfigManager::handleRawExec(const std::string& command, const std::string& args) {
+    if (m_bNoSideEffects)
+        return;
+
     // Exec in the background dont wait for it.
     g_pKeybindManager->spawn(args);
 }
@@ -799,6 +685,8 @@ void CConfigManager::handleWindowRule(const std::string& command, const std::str
 
     if (RULE == "unset") {
         std::erase_if(m_dWindowRules, [&](const SWindowRule& other) { return other.szValue == VALUE; });
+        if (!m_bIsReloading)
+            invalidateRuleCache();
         return;
     }
 
@@ -810,6 +698,9 @@ void CConfigManager::handleWindowRule(const std::string& command, const std::str
     }
 
     m_dWindowRules.push_back({RULE, VALUE});
+
+    if (!m_bIsReloading)
+        invalidateRuleCache();
 }
 
 void CConfigManager::handleLayerRule(const std::string& command, const std::string& value) {
@@ -833,6 +724,9 @@ void CConfigManager::handleLayerRule(const std::string& command, const std::stri
 
     m_dLayerRules.push_back({VALUE, RULE});
 
+    if (m_bIsReloading)
+        return; // applied once after the reload if anything changed
+
     for (auto& m : g_pCompositor->m_vMonitors)
         for (auto& lsl : m->m_aLayerSurfaceLayers)
             for (auto& ls : lsl)
@@ -953,10 +847,15 @@ void CConfigManager::handleWindowRuleV2(const std::string& command, const std::s
                 return true;
             }
         });
+        if (!m_bIsReloading)
+            invalidateRuleCache();
         return;
     }
 
     m_dWindowRules.push_back(rule);
+
+    if (!m_bIsReloading)
+        invalidateRuleCache();
 }
 
 void CConfigManager::updateBlurredLS(const std::string& name, const bool forceBlur) {
@@ -983,13 +882,15 @@ void CConfigManager::updateBlurredLS(const std::string& name, const bool forceBl
 void CConfigManager::handleBlurLS(const std::string& command, const std::string& value) {
     if (value.find("remove,") == 0) {
         const auto TOREMOVE = removeBeginEndSpacesTabs(value.substr(7));
-        if (std::erase_if(m_dBlurLSNamespaces, [&](const auto& other) { return other == TOREMOVE; }))
+        if (std::erase_if(m_dBlurLSNamespaces, [&](const auto& other) { return other == TOREMOVE; }) && !m_bNoSideEffects)
             updateBlurredLS(TOREMOVE, false);
         return;
     }
 
     m_dBlurLSNamespaces.emplace_back(value);
-    updateBlurredLS(value, true);
+
+    if (!m_bNoSideEffects)
+        updateBlurredLS(value, true);
 }
 
 void CConfigManager::handleDefaultWorkspace(const std::string& command, const std::string& value) {
@@ -1073,7 +974,7 @@ void CConfigManager::handleBindWS(const std::string& command, const std::string&
 }
 
 void CConfigManager::handleEnv(const std::string& command, const std::string& value) {
-    if (!isFirstLaunch)
+    if (!isFirstLaunch || m_bNoSideEffects)
         return;
 
     const auto ARGS = CVarList(value, 2);
@@ -1162,13 +1063,13 @@ std::string CConfigManager::parseKeyword(const std::string& COMMAND, const std::
         g_pCompositor->updateAllWindowsAnimatedDecorationValues();
 
         // manual crash
-        if (configValues["debug:manual_crash"].intValue && !m_bManualCrashInitiated) {
+        if (configValues[CFG_DEBUG_MANUAL_CRASH].intValue && !m_bManualCrashInitiated) {
             m_bManualCrashInitiated = true;
             if (g_pHyprNotificationOverlay) {
                 g_pHyprNotificationOverlay->addNotification("Manual crash has been set up. Set debug:manual_crash back to 0 in order to crash the compositor.", CColor(0), 5000,
                                                             ICON_INFO);
             }
-        } else if (m_bManualCrashInitiated && !configValues["debug:manual_crash"].intValue) {
+        } else if (m_bManualCrashInitiated && !configValues[CFG_DEBUG_MANUAL_CRASH].intValue) {
             // cowabunga it is
             g_pHyprRenderer->initiateManualCrash();
         }
@@ -1199,6 +1100,9 @@ void CConfigManager::applyUserDefinedVars(std::string& line, const size_t equals
             for (auto& [var, value] : environmentVariables) {
                 if (STRAFTERDOLLAR.find(var) == 0) {
                     line.replace(dollarPlace, var.length() + 1, value);
+
+                    if (m_bRecordingKeywords)
+                        m_vRecordedEnv.emplace_back(var, value);
                     break;
                 }
             }
@@ -1273,29 +1177,39 @@ void CConfigManager::parseLine(std::string& line) {
     const auto VALUE   = removeBeginEndSpacesTabs(line.substr(EQUALSPLACE + 1));
     //
 
+    // sourced files are recorded inline
+    if (m_bRecordingKeywords && COMMAND != "source")
+        m_vRecordedKeywords.push_back({currentCategory, COMMAND, VALUE, configCurrentPath});
+
+    if (m_bDryParse && COMMAND != "source" && COMMAND[0] != '$')
+        return;
+
     parseKeyword(COMMAND, VALUE);
 }
 
-void CConfigManager::loadConfigLoadVars() {
+void CConfigManager::loadConfigLoadVars(bool fullApply) {
     Debug::log(LOG, "Reloading the config!");
     parseError      = ""; // reset the error
     currentCategory = ""; // reset the category
 
+    HyprCtl::markStateChanged();
+
+    // the first launch has nothing to diff against
+    fullApply = fullApply || isFirstLaunch;
+
+    // keep what we had, so that only the changed parts get re-applied afterwards
+    const auto PREVIOUS         = takeSnapshot();
+    auto       previousBinds      = std::move(g_pKeybindManager->m_lKeybinds);
+    const auto PREVIOUSACTIVEBIND = g_pKeybindManager->m_pActiveKeybind; // addKeybind clears it while parsing
+    const bool BINDINDEXISFRESH   = !g_pKeybindManager->m_bKeybindIndexDirty;
+    m_bIsReloading                = true;
+
     // reset all vars before loading
-    setDefaultVars();
-    m_dMonitorRules.clear();
-    m_dWindowRules.clear();
-    g_pKeybindManager->clearKeybinds();
-    g_pAnimationManager->removeAllBeziers();
-    m_mAdditionalReservedAreas.clear();
-    configDynamicVars.clear();
-    deviceConfigs.clear();
-    m_dBlurLSNamespaces.clear();
-    boundWorkspaces.clear();
-    setDefaultAnimationVars(); // reset anims
+    clearParsedConfig();
 
     // paths
     configPaths.clear();
+    m_szScreenShaderPath = "";
 
     std::string              CONFIGPATH;
 
@@ -1310,10 +1224,16 @@ void CConfigManager::loadConfigLoadVars() {
 
     configPaths.push_back(CONFIGPATH);
 
+    // on startup, a fresh snapshot saves reading, lexing and substituting every file
+    const auto   PARSEBEGIN = std::chrono::high_resolution_clock::now();
+    SConfigCache cache;
+    const bool   FROMCACHE = isFirstLaunch && readConfigCache(getConfigCachePath(), CONFIGPATH, cache);
+
     std::ifstream ifs;
-    ifs.open(CONFIGPATH);
+    if (!FROMCACHE)
+        ifs.open(CONFIGPATH);
 
-    if (!ifs.good()) {
+    if (!FROMCACHE && !ifs.good()) {
         if (g_pCompositor->explicitConfigPath == "") {
             Debug::log(WARN, "Config reading error. (No file? Attempting to generate, backing up old one if exists)");
             try {
@@ -1325,7 +1245,8 @@ void CConfigManager::loadConfigLoadVars() {
                 if (!std::filesystem::is_directory(CONFIGPARENTPATH))
                     std::filesystem::create_directories(CONFIGPARENTPATH);
             } catch (...) {
-                parseError = "Broken config file! (Could not create directory)";
+                parseError     = "Broken config file! (Could not create directory)";
+                m_bIsReloading = false;
                 return;
             }
         }
@@ -1340,11 +1261,16 @@ void CConfigManager::loadConfigLoadVars() {
         ifs.open(CONFIGPATH);
 
         if (!ifs.good()) {
-            parseError = "Broken config file! (Could not open)";
+            parseError     = "Broken config file! (Could not open)";
+            m_bIsReloading = false;
             return;
         }
     }
 
+    m_vRecordedKeywords.clear();
+    m_vRecordedEnv.clear();
+    m_bRecordingKeywords = ifs.is_open();
+
     std::string line    = "";
     int         linenum = 1;
     if (ifs.is_open()) {
@@ -1370,24 +1296,84 @@ void CConfigManager::loadConfigLoadVars() {
         ifs.close();
     }
 
-    for (auto& m : g_pCompositor->m_vMonitors)
-        g_pLayoutManager->getCurrentLayout()->recalculateMonitor(m->ID);
+    if (FROMCACHE)
+        replayConfigCache(cache);
+
+    m_bRecordingKeywords = false;
+
+    Debug::log(LOG, "Config %s in %.2fms", FROMCACHE ? "loaded from the startup cache" : "parsed",
+               std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - PARSEBEGIN).count() / 1000.f);
+
+    if (!FROMCACHE) {
+        if (configValues[CFG_MISC_CACHE_CONFIG].intValue && parseError.empty())
+            writeConfigCache(getConfigCachePath(), CONFIGPATH);
+        else {
+            std::error_code ec;
+            std::filesystem::remove(getConfigCachePath(), ec);
+        }
+    }
+
+    m_vRecordedKeywords.clear();
+    m_vRecordedEnv.clear();
+
+    m_bIsReloading = false;
+
+    g_pAnimationManager->pruneUnusedBeziers();
+
+    SConfigDiff diff = diffAgainst(PREVIOUS);
+
+    // keep the old bind list if nothing changed, that way held / shadowed binds survive the reload
+    if (std::equal(previousBinds.begin(), previousBinds.end(), g_pKeybindManager->m_lKeybinds.begin(), g_pKeybindManager->m_lKeybinds.end(),
+                   [](const SKeybind& a, const SKeybind& b) {
+                       return a.key == b.key && a.keycode == b.keycode && a.modmask == b.modmask && a.handler == b.handler && a.arg == b.arg && a.locked == b.locked &&
+                           a.submap == b.submap && a.release == b.release && a.repeat == b.repeat && a.mouse == b.mouse;
+                   })) {
+        // the list keeps its nodes when moved, so an index built on them is still good
+        g_pKeybindManager->m_lKeybinds          = std::move(previousBinds);
+        g_pKeybindManager->m_bKeybindIndexDirty = !BINDINDEXISFRESH;
+        g_pKeybindManager->m_pActiveKeybind     = PREVIOUSACTIVEBIND;
+    } else {
+        diff.binds                          = true;
+        g_pKeybindManager->m_pActiveKeybind = nullptr;
+    }
+
+    diff.screenShader          = diff.screenShader || m_bScreenShaderFileChanged;
+    m_bScreenShaderFileChanged = false;
+
+    if (!fullApply)
+        Debug::log(LOG, "Config diff: layout %i, decoration %i, blur %i, shader %i, input %i, monitors %i, vrr %i, binds %i, windowrules %i, layerrules %i, other %i",
+                   diff.layout, diff.decoration, diff.blur, diff.screenShader, diff.input, diff.monitors, diff.vrr, diff.binds, diff.windowRules, diff.layerRules, diff.other);
+
+    if (fullApply || diff.windowRules)
+        invalidateRuleCache();
+
+    if (fullApply || diff.layerRules) {
+        for (auto& m : g_pCompositor->m_vMonitors)
+            for (auto& lsl : m->m_aLayerSurfaceLayers)
+                for (auto& ls : lsl)
+                    ls->applyRules();
+    }
+
+    if (fullApply || diff.layout || diff.monitors) {
+        for (auto& m : g_pCompositor->m_vMonitors)
+            g_pLayoutManager->getCurrentLayout()->recalculateMonitor(m->ID);
+    }
 
     // Update the keyboard layout to the cfg'd one if this is not the first launch
-    if (!isFirstLaunch) {
+    if (!isFirstLaunch && (fullApply || diff.input)) {
         g_pInputManager->setKeyboardLayout();
         g_pInputManager->setPointerConfigs();
         g_pInputManager->setTouchDeviceConfigs();
         g_pInputManager->setTabletConfigs();
     }
 
-    if (!isFirstLaunch)
+    if (!isFirstLaunch && (fullApply || diff.screenShader))
         g_pHyprOpenGL->m_bReloadScreenShader = true;
 
     // parseError will be displayed next frame
     if (parseError != "")
         g_pHyprError->queueCreate(parseError + "\nHyprland may not work correctly.", CColor(1.0, 50.0 / 255.0, 50.0 / 255.0, 1.0));
-    else if (configValues["autogenerated"].intValue == 1)
+    else if (configValues[CFG_AUTOGENERATED].intValue == 1)
         g_pHyprError->queueCreate("Warning: You're using an autogenerated config! (config file: " + CONFIGPATH + " )\nSUPER+Q -> kitty\nSUPER+M -> exit Hyprland",
                                   CColor(1.0, 1.0, 70.0 / 255.0, 1.0));
     else
@@ -1399,38 +1385,185 @@ void CConfigManager::loadConfigLoadVars() {
     // ignore if nomonitorreload is set
     if (!isFirstLaunch && !m_bNoMonitorReload) {
         // check
-        performMonitorReload();
-        ensureMonitorStatus();
-        ensureVRR();
+        if (fullApply || diff.monitors) {
+            performMonitorReload();
+            ensureMonitorStatus();
+        }
+
+        if (fullApply || diff.monitors || diff.vrr)
+            ensureVRR();
     }
 
     // Update window border colors
-    g_pCompositor->updateAllWindowsAnimatedDecorationValues();
+    if (fullApply || diff.decoration || diff.windowRules)
+        g_pCompositor->updateAllWindowsAnimatedDecorationValues();
 
     // update layout
-    g_pLayoutManager->switchToLayout(configValues["general:layout"].strValue);
+    g_pLayoutManager->switchToLayout(configValues[CFG_GENERAL_LAYOUT].strValue);
 
     // manual crash
-    if (configValues["debug:manual_crash"].intValue && !m_bManualCrashInitiated) {
+    if (configValues[CFG_DEBUG_MANUAL_CRASH].intValue && !m_bManualCrashInitiated) {
         m_bManualCrashInitiated = true;
         g_pHyprNotificationOverlay->addNotification("Manual crash has been set up. Set debug:manual_crash back to 0 in order to crash the compositor.", CColor(0), 5000, ICON_INFO);
-    } else if (m_bManualCrashInitiated && !configValues["debug:manual_crash"].intValue) {
+    } else if (m_bManualCrashInitiated && !configValues[CFG_DEBUG_MANUAL_CRASH].intValue) {
         // cowabunga it is
         g_pHyprRenderer->initiateManualCrash();
     }
 
-    Debug::disableStdout = !configValues["debug:enable_stdout_logs"].intValue;
+    Debug::disableStdout = !configValues[CFG_DEBUG_ENABLE_STDOUT_LOGS].intValue;
 
-    for (auto& m : g_pCompositor->m_vMonitors) {
-        // mark blur dirty
-        g_pHyprOpenGL->markBlurDirtyForMonitor(m.get());
+    if (fullApply || diff.visual()) {
+        for (auto& m : g_pCompositor->m_vMonitors) {
+            // mark blur dirty
+            if (fullApply || diff.blur || diff.monitors || diff.screenShader)
+                g_pHyprOpenGL->markBlurDirtyForMonitor(m.get());
 
-        // Force the compositor to fully re-render all monitors
-        m->forceFullFrames = 2;
+            // Force the compositor to fully re-render all monitors
+            m->forceFullFrames = 2;
+        }
     }
 
     // Reset no monitor reload
     m_bNoMonitorReload = false;
+
+    // sourced files might have changed
+    updateConfigWatches();
+}
+
+void CConfigManager::clearParsedConfig() {
+    setDefaultVars();
+    m_dMonitorRules.clear();
+    m_dWindowRules.clear();
+    m_dLayerRules.clear();
+    g_pKeybindManager->clearKeybinds();
+    g_pAnimationManager->removeAllBeziers();
+    m_mAdditionalReservedAreas.clear();
+    configDynamicVars.clear();
+    deviceConfigs.clear();
+    m_dBlurLSNamespaces.clear();
+    boundWorkspaces.clear();
+    setDefaultAnimationVars(); // reset anims
+}
+
+SConfigSnapshot CConfigManager::takeSnapshot() {
+    SConfigSnapshot snapshot = {configValues, deviceConfigs, m_dMonitorRules, m_mAdditionalReservedAreas, m_dWindowRules, m_dLayerRules, m_dBlurLSNamespaces};
+
+    // custom data is reset in place by setDefaultVars, so it has to be deep-copied
+    for (auto& value : snapshot.values) {
+        if (!value.data)
+            continue;
+
+        switch (value.data->getDataType()) {
+            case CVD_TYPE_GRADIENT: value.data = std::make_shared<CGradientValueData>(*(CGradientValueData*)value.data.get()); break;
+            default: UNREACHABLE();
+        }
+    }
+
+    return snapshot;
+}
+
+void CConfigManager::restoreSnapshot(const SConfigSnapshot& snapshot) {
+    for (size_t i = 0; i < CFG_KEYS_COUNT; ++i) {
+        // custom data is held by pointer elsewhere, copy it back into the live object
+        const auto DATA = configValues[i].data;
+        configValues[i] = snapshot.values[i];
+
+        if (!DATA || !snapshot.values[i].data)
+            continue;
+
+        switch (DATA->getDataType()) {
+            case CVD_TYPE_GRADIENT: *(CGradientValueData*)DATA.get() = *(CGradientValueData*)snapshot.values[i].data.get(); break;
+            default: UNREACHABLE();
+        }
+
+        configValues[i].data = DATA;
+    }
+
+    deviceConfigs              = snapshot.deviceConfigs;
+    m_dMonitorRules            = snapshot.monitorRules;
+    m_mAdditionalReservedAreas = snapshot.reservedAreas;
+    m_dWindowRules             = snapshot.windowRules;
+    m_dLayerRules              = snapshot.layerRules;
+    m_dBlurLSNamespaces        = snapshot.blurLSNamespaces;
+}
+
+static bool configValuesEqual(const SConfigValue& a, const SConfigValue& b) {
+    if (a.intValue != b.intValue || a.floatValue != b.floatValue || a.strValue != b.strValue || a.vecValue != b.vecValue)
+        return false;
+
+    if (!a.data || !b.data)
+        return a.data == b.data;
+
+    if (a.data->getDataType() != b.data->getDataType())
+        return false;
+
+    switch (a.data->getDataType()) {
+        case CVD_TYPE_GRADIENT: return *(CGradientValueData*)a.data.get() == *(CGradientValueData*)b.data.get();
+        default: UNREACHABLE();
+    }
+
+    return false;
+}
+
+SConfigDiff CConfigManager::diffAgainst(const SConfigSnapshot& previous) {
+    SConfigDiff diff;
+
+    for (size_t i = 0; i < CFG_KEYS_COUNT; ++i) {
+        if (configValuesEqual(previous.values[i], configValues[i]))
+            continue;
+
+        const std::string name = CONFIG_KEY_INFO[i].name;
+
+        if (name.find("input:") == 0)
+            diff.input = true;
+        else if (name == "general:border_size" || name == "general:no_border_on_floating") {
+            // resizes the windows and changes the border decorations' extents
+            diff.layout     = true;
+            diff.decoration = true;
+        } else if (name.find("general:gaps_") == 0 || name == "general:layout" || name.find("dwindle:") == 0 || name.find("master:") == 0)
+            diff.layout = true;
+        else if (name == "decoration:screen_shader")
+            diff.screenShader = true;
+        else if (name.find("decoration:blur") == 0)
+            diff.blur = true;
+        else if (name.find("decoration:") == 0 || name.find("general:col.") == 0)
+            diff.decoration = true;
+        else if (name == "misc:vrr")
+            diff.vrr = true;
+        else
+            diff.other = true;
+    }
+
+    if (deviceConfigs.size() != previous.deviceConfigs.size())
+        diff.input = true;
+    else {
+        for (auto& [dev, values] : deviceConfigs) {
+            const auto IT = previous.deviceConfigs.find(dev);
+
+            if (IT == previous.deviceConfigs.end() || IT->second.size() != values.size()) {
+                diff.input = true;
+                break;
+            }
+
+            for (auto& [name, value] : values) {
+                const auto VALIT = IT->second.find(name);
+
+                if (VALIT == IT->second.end() || !configValuesEqual(VALIT->second, value) || VALIT->second.set != value.set) {
+                    diff.input = true;
+                    break;
+                }
+            }
+
+            if (diff.input)
+                break;
+        }
+    }
+
+    diff.monitors    = m_dMonitorRules != previous.monitorRules || m_mAdditionalReservedAreas != previous.reservedAreas;
+    diff.windowRules = m_dWindowRules != previous.windowRules;
+    diff.layerRules  = m_dLayerRules != previous.layerRules || m_dBlurLSNamespaces != previous.blurLSNamespaces;
+
+    return diff;
 }
 
 void CConfigManager::tick() {
@@ -1447,7 +1580,8 @@ void CConfigManager::tick() {
         return;
     }
 
-    bool parse = false;
+    bool       parse     = false;
+    const bool FULLAPPLY = m_bForceReload;
 
     for (auto& cf : configPaths) {
         struct stat fileStat;
@@ -1461,26 +1595,609 @@ void CConfigManager::tick() {
         if (fileStat.st_mtime != configModifyTimes[cf] || m_bForceReload) {
             parse                 = true;
             configModifyTimes[cf] = fileStat.st_mtime;
+
+            if (cf == m_szScreenShaderPath)
+                m_bScreenShaderFileChanged = true;
         }
     }
 
     if (parse) {
         m_bForceReload = false;
 
-        loadConfigLoadVars();
+        loadConfigLoadVars(FULLAPPLY);
+    }
+}
+
+void CConfigManager::startConfigWatcher() {
+    m_iConfigWatchFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (m_iConfigWatchFD < 0) {
+        Debug::log(ERR, "Couldn't init inotify, error %i: %s. Falling back to polling the config.", errno, strerror(errno));
+        return;
+    }
+
+    m_pConfigWatchSource   = wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, m_iConfigWatchFD, WL_EVENT_READABLE, &CConfigManager::onConfigWatchEvent, this);
+    m_pConfigDebounceTimer = wl_event_loop_add_timer(g_pCompositor->m_sWLEventLoop, &CConfigManager::onConfigDebounceTimer, this);
+}
+
+bool CConfigManager::isWatchingConfig() {
+    return m_iConfigWatchFD >= 0;
+}
+
+void CConfigManager::scheduleReload() {
+    m_bForceReload = true;
+
+    // otherwise the polling timer will pick it up
+    if (isWatchingConfig())
+        wl_event_source_timer_update(m_pConfigDebounceTimer, 1);
+}
+
+void CConfigManager::updateConfigWatches() {
+    if (m_iConfigWatchFD < 0)
+        return;
+
+    // we watch directories, not files. Editors commonly save by writing a new file and renaming it over the old one,
+    // which a watch on the file itself would not survive.
+    m_sConfigWatchFiles.clear();
+    std::unordered_set<std::string> dirs;
+
+    const auto                      addPath = [&](const std::filesystem::path& path) {
+        const auto NORMAL = path.lexically_normal();
+        m_sConfigWatchFiles.insert(NORMAL.string());
+        dirs.insert(NORMAL.parent_path().string());
+    };
+
+    for (auto& cf : configPaths) {
+        addPath(cf);
+
+        // follow symlinks, e.g. configs managed by home-manager
+        std::error_code ec;
+        const auto      CANONICAL = std::filesystem::canonical(cf, ec);
+        if (!ec && CANONICAL != std::filesystem::path(cf).lexically_normal())
+            addPath(CANONICAL);
+    }
+
+    // a removed directory can't be watched, watch its closest existing parent to notice it being recreated
+    m_sConfigWatchMissingDirs.clear();
+    std::unordered_set<std::string> targets;
+
+    for (auto& dir : dirs) {
+        std::error_code       ec;
+        std::filesystem::path target = dir;
+
+        while (!std::filesystem::is_directory(target, ec) && target.has_parent_path() && target.parent_path() != target)
+            target = target.parent_path();
+
+        if (target != dir)
+            m_sConfigWatchMissingDirs.insert(dir);
+
+        targets.insert(target.string());
+    }
+
+    for (auto it = m_mConfigWatchDirs.begin(); it != m_mConfigWatchDirs.end();) {
+        if (!targets.contains(it->second)) {
+            inotify_rm_watch(m_iConfigWatchFD, it->first);
+            it = m_mConfigWatchDirs.erase(it);
+        } else
+            ++it;
+    }
+
+    for (auto& dir : targets) {
+        if (std::find_if(m_mConfigWatchDirs.begin(), m_mConfigWatchDirs.end(), [&](const auto& other) { return other.second == dir; }) != m_mConfigWatchDirs.end())
+            continue;
+
+        const auto WD = inotify_add_watch(m_iConfigWatchFD, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE_SELF | IN_MOVE_SELF);
+
+        if (WD < 0) {
+            Debug::log(WARN, "Couldn't watch config dir %s, error %i: %s", dir.c_str(), errno, strerror(errno));
+            continue;
+        }
+
+        m_mConfigWatchDirs[WD] = dir;
     }
 }
 
+int CConfigManager::onConfigWatchEvent(int fd, uint32_t mask, void* data) {
+    const auto PTHIS = (CConfigManager*)data;
+
+    if (mask & WL_EVENT_ERROR || mask & WL_EVENT_HANGUP)
+        return 0;
+
+    alignas(inotify_event) char buffer[4096];
+    bool                        reload  = false;
+    bool                        rewatch = false;
+
+    while (true) {
+        const auto LEN = read(fd, buffer, sizeof(buffer));
+
+        if (LEN <= 0)
+            break;
+
+        for (char* ptr = buffer; ptr < buffer + LEN;) {
+            const auto EVENT = (inotify_event*)ptr;
+            ptr += sizeof(inotify_event) + EVENT->len;
+
+            const auto DIR = PTHIS->m_mConfigWatchDirs.find(EVENT->wd);
+
+            if (DIR == PTHIS->m_mConfigWatchDirs.end())
+                continue;
+
+            if (EVENT->mask & IN_IGNORED) {
+                PTHIS->m_mConfigWatchDirs.erase(DIR);
+                continue;
+            }
+
+            if (EVENT->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+                // a moved directory keeps its watch, drop it. Either way watch its parent until it's back.
+                inotify_rm_watch(fd, EVENT->wd);
+                PTHIS->m_mConfigWatchDirs.erase(DIR);
+                rewatch = true;
+                continue;
+            }
+
+            if (EVENT->len == 0)
+                continue;
+
+            const auto PATH = DIR->second + "/" + EVENT->name;
+
+            if (EVENT->mask & IN_ISDIR) {
+                // one of the removed directories (or a parent of it) came back
+                if (std::any_of(PTHIS->m_sConfigWatchMissingDirs.begin(), PTHIS->m_sConfigWatchMissingDirs.end(),
+                                [&](const auto& missing) { return missing == PATH || missing.starts_with(PATH + "/"); }))
+                    rewatch = true;
+                continue;
+            }
+
+            if (!PTHIS->m_sConfigWatchFiles.contains(PATH))
+                continue;
+
+            if (!PTHIS->m_szScreenShaderPath.empty() && PATH == std::filesystem::path(PTHIS->m_szScreenShaderPath).lexically_normal().string())
+                PTHIS->m_bScreenShaderFileChanged = true;
+
+            reload = true;
+        }
+    }
+
+    // the files in a recreated directory may have been written before the new watch was added, so reload too
+    if (rewatch) {
+        PTHIS->updateConfigWatches();
+        reload = true;
+    }
+
+    // editors tend to write a file in several steps, wait for the burst to end
+    if (reload)
+        wl_event_source_timer_update(PTHIS->m_pConfigDebounceTimer, CONFIG_RELOAD_DEBOUNCE_MS);
+
+    return 0;
+}
+
+int CConfigManager::onConfigDebounceTimer(void* data) {
+    const auto         PTHIS = (CConfigManager*)data;
+
+    static auto* const PDISABLECFGRELOAD = &PTHIS->getConfigValuePtr(CFG_MISC_DISABLE_AUTORELOAD)->intValue;
+
+    if (PTHIS->m_bForceReload) {
+        PTHIS->tick();
+        return 0;
+    }
+
+    if (*PDISABLECFGRELOAD == 1)
+        return 0;
+
+    if (PTHIS->configPaths.empty() || !std::filesystem::exists(PTHIS->configPaths.front())) {
+        Debug::log(ERR, "Config doesn't exist??");
+        return 0;
+    }
+
+    PTHIS->loadConfigLoadVars(false);
+
+    return 0;
+}
+
+static uint64_t fnv1a(const char* data, size_t len, uint64_t hash = 0xcbf29ce484222325) {
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= (uint8_t)data[i];
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
+
+// fills in mtime, size and hash for file.path
+static bool statConfigCacheFile(SConfigCacheFile& file) {
+    struct stat fileStat;
+    if (stat(file.path.c_str(), &fileStat) != 0)
+        return false;
+
+    file.mtime = fileStat.st_mtim.tv_sec * 1000000000LL + fileStat.st_mtim.tv_nsec;
+    file.size  = fileStat.st_size;
+
+    std::ifstream ifs(file.path, std::ios::binary);
+    if (!ifs.good())
+        return false;
+
+    char buf[4096];
+    file.hash = 0xcbf29ce484222325;
+    while (ifs.read(buf, sizeof(buf)) || ifs.gcount() > 0)
+        file.hash = fnv1a(buf, ifs.gcount(), file.hash);
+
+    return true;
+}
+
+template <typename T>
+static void writeCacheValue(std::string& out, const T& val) {
+    out.append((const char*)&val, sizeof(T));
+}
+
+static void writeCacheString(std::string& out, const std::string& str) {
+    writeCacheValue(out, (uint32_t)str.length());
+    out.append(str);
+}
+
+static const std::string CONFIG_CACHE_MAGIC = std::string("HYPRCFG\0", 8);
+
+std::string CConfigManager::getConfigCachePath() {
+    static const char* const ENVCACHE = getenv("XDG_CACHE_HOME");
+    static const char* const ENVHOME  = getenv("HOME");
+
+    return (ENVCACHE ? std::string(ENVCACHE) : ENVHOME + std::string("/.cache")) + "/hyprland/config.cache";
+}
+
+bool CConfigManager::readConfigCache(const std::string& cachePath, const std::string& mainPath, SConfigCache& cache) {
+    std::ifstream ifs(cachePath, std::ios::binary);
+    if (!ifs.good())
+        return false;
+
+    const std::string DATA((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+    if (DATA.length() < CONFIG_CACHE_MAGIC.length() + sizeof(uint64_t) || DATA.compare(0, CONFIG_CACHE_MAGIC.length(), CONFIG_CACHE_MAGIC) != 0) {
+        Debug::log(WARN, "Config cache at %s is not a config cache, ignoring", cachePath.c_str());
+        return false;
+    }
+
+    // the checksum is the last thing written, catches truncated and corrupted files
+    const size_t PAYLOADLEN = DATA.length() - sizeof(uint64_t);
+    uint64_t     checksum   = 0;
+    memcpy(&checksum, DATA.data() + PAYLOADLEN, sizeof(checksum));
+
+    if (checksum != fnv1a(DATA.data(), PAYLOADLEN)) {
+        Debug::log(WARN, "Config cache at %s is corrupted, ignoring", cachePath.c_str());
+        return false;
+    }
+
+    size_t pos       = CONFIG_CACHE_MAGIC.length();
+    auto   readBytes = [&](void* out, size_t len) {
+        if (pos + len > PAYLOADLEN)
+            return false;
+
+        memcpy(out, DATA.data() + pos, len);
+        pos += len;
+        return true;
+    };
+    auto readString = [&](std::string& out) {
+        uint32_t len = 0;
+        if (!readBytes(&len, sizeof(len)) || pos + len > PAYLOADLEN)
+            return false;
+
+        out = DATA.substr(pos, len);
+        pos += len;
+        return true;
+    };
+
+    uint32_t    version = 0;
+    std::string commit  = "";
+    if (!readBytes(&version, sizeof(version)) || version != CONFIG_CACHE_VERSION || !readString(commit) || commit != GIT_COMMIT_HASH) {
+        Debug::log(LOG, "Config cache was written by another version of Hyprland, ignoring");
+        return false;
+    }
+
+    if (!readString(cache.mainPath) || cache.mainPath != mainPath)
+        return false;
+
+    uint32_t count = 0;
+    if (!readBytes(&count, sizeof(count)))
+        return false;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        SConfigCacheFile file;
+        if (!readString(file.path) || !readBytes(&file.mtime, sizeof(file.mtime)) || !readBytes(&file.size, sizeof(file.size)) || !readBytes(&file.hash, sizeof(file.hash)))
+            return false;
+
+        SConfigCacheFile current = {file.path};
+        if (!statConfigCacheFile(current) || current.mtime != file.mtime || current.size != file.size || current.hash != file.hash) {
+            Debug::log(LOG, "Config cache is stale (%s changed), parsing the config", file.path.c_str());
+            return false;
+        }
+
+        cache.files.push_back(file);
+    }
+
+    if (!readBytes(&count, sizeof(count)))
+        return false;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        std::string name = "", value = "";
+        if (!readString(name) || !readString(value))
+            return false;
+
+        const auto ENV = getenv(name.c_str());
+        if (!ENV || value != ENV) {
+            Debug::log(LOG, "Config cache is stale ($%s changed), parsing the config", name.c_str());
+            return false;
+        }
+
+        cache.env.emplace_back(name, value);
+    }
+
+    if (!readBytes(&count, sizeof(count)))
+        return false;
+
+    cache.entries.resize(count);
+    for (auto& entry : cache.entries) {
+        if (!readString(entry.category) || !readString(entry.command) || !readString(entry.value) || !readString(entry.path))
+            return false;
+    }
+
+    return pos == PAYLOADLEN;
+}
+
+bool CConfigManager::writeConfigCache(const std::string& cachePath, const std::string& mainPath) {
+    std::string data = CONFIG_CACHE_MAGIC;
+
+    writeCacheValue(data, (uint32_t)CONFIG_CACHE_VERSION);
+    writeCacheString(data, GIT_COMMIT_HASH);
+    writeCacheString(data, mainPath);
+
+    writeCacheValue(data, (uint32_t)configPaths.size());
+    for (auto& path : configPaths) {
+        SConfigCacheFile file = {path};
+        if (!statConfigCacheFile(file)) {
+            Debug::log(WARN, "Couldn't stat %s, not writing the config cache", path.c_str());
+            return false;
+        }
+
+        writeCacheString(data, file.path);
+        writeCacheValue(data, file.mtime);
+        writeCacheValue(data, file.size);
+        writeCacheValue(data, file.hash);
+    }
+
+    writeCacheValue(data, (uint32_t)m_vRecordedEnv.size());
+    for (auto& [name, value] : m_vRecordedEnv) {
+        writeCacheString(data, name);
+        writeCacheString(data, value);
+    }
+
+    writeCacheValue(data, (uint32_t)m_vRecordedKeywords.size());
+    for (auto& entry : m_vRecordedKeywords) {
+        writeCacheString(data, entry.category);
+        writeCacheString(data, entry.command);
+        writeCacheString(data, entry.value);
+        writeCacheString(data, entry.path);
+    }
+
+    writeCacheValue(data, fnv1a(data.data(), data.length()));
+
+    // write to a temporary file and rename it over, a half-written cache would only be ignored but this avoids reparsing for nothing
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), ec);
+
+    const auto    TMPPATH = cachePath + ".tmp";
+    std::ofstream ofs(TMPPATH, std::ios::binary | std::ios::trunc);
+    ofs.write(data.data(), data.length());
+    ofs.close();
+
+    if (!ofs.good()) {
+        Debug::log(WARN, "Couldn't write the config cache to %s", TMPPATH.c_str());
+        return false;
+    }
+
+    std::filesystem::rename(TMPPATH, cachePath, ec);
+    if (ec) {
+        Debug::log(WARN, "Couldn't write the config cache to %s: %s", cachePath.c_str(), ec.message().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void CConfigManager::replayConfigCache(const SConfigCache& cache) {
+    // the main config is already in configPaths, handleSource would have added the rest
+    for (size_t i = 1; i < cache.files.size(); ++i)
+        configPaths.push_back(cache.files[i].path);
+
+    for (auto& file : cache.files)
+        configModifyTimes[file.path] = file.mtime / 1000000000LL;
+
+    for (auto& entry : cache.entries) {
+        currentCategory   = entry.category;
+        configCurrentPath = entry.path;
+        parseKeyword(entry.command, entry.value);
+    }
+
+    currentCategory = "";
+}
+
+void CConfigManager::dryParseFile(const std::string& path) {
+    std::ifstream ifs(path);
+    std::string   line = "";
+
+    while (std::getline(ifs, line)) {
+        try {
+            configCurrentPath = path;
+            parseLine(line);
+        } catch (...) {
+            // errors are reported by the real parse
+        }
+    }
+}
+
+std::string CConfigManager::benchmarkConfigCache(int iterations, const std::string& path) {
+    if (path.empty() && configPaths.empty())
+        return "no config loaded, pass a path";
+
+    const auto MAINPATH = path.empty() ? configPaths.front() : path;
+
+    // everything below runs on the compositor thread
+    iterations = std::clamp(iterations, 1, CONFIGBENCH_MAX_ITERATIONS);
+
+    if (!std::filesystem::exists(MAINPATH))
+        return "config file " + MAINPATH + " doesn't exist";
+
+    // everything a dry parse touches, restored afterwards
+    const auto PATHS       = configPaths;
+    const auto MODIFYTIMES = configModifyTimes;
+    const auto DYNAMICVARS = configDynamicVars;
+    const auto CATEGORY    = currentCategory;
+    const auto CURRENTPATH = configCurrentPath;
+    const auto PARSEERROR  = parseError;
+
+    // cold: read, lex, follow sources and substitute variables. Applying the keywords is timed on its own below, it costs the same both ways.
+    m_bDryParse          = true;
+    m_bRecordingKeywords = true;
+
+    const auto COLDBEGIN = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        m_vRecordedKeywords.clear();
+        m_vRecordedEnv.clear();
+        configDynamicVars.clear();
+        configPaths     = {MAINPATH};
+        currentCategory = "";
+
+        dryParseFile(MAINPATH);
+    }
+    const float COLDMS = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - COLDBEGIN).count() / 1000.f / iterations;
+
+    m_bDryParse          = false;
+    m_bRecordingKeywords = false;
+
+    const auto FILES     = configPaths.size();
+    const auto KEYWORDS  = m_vRecordedKeywords.size();
+    const auto CACHEPATH = "/tmp/hypr/" + g_pCompositor->m_szInstanceSignature + "/configbench.cache";
+
+    bool       ok = writeConfigCache(CACHEPATH, MAINPATH);
+
+    // snapshot: read the cache and check every file's mtime, size and hash
+    const auto CACHEBEGIN = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations && ok; ++i) {
+        SConfigCache cache;
+        ok = readConfigCache(CACHEPATH, MAINPATH, cache) && cache.entries.size() == KEYWORDS;
+    }
+    const float CACHEMS = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - CACHEBEGIN).count() / 1000.f / iterations;
+
+    std::error_code ec;
+    std::filesystem::remove(CACHEPATH, ec);
+
+    // apply: reset to the defaults and feed every keyword to parseKeyword, as both a parse and a replay do.
+    // it works on the live containers, so everything it touches is saved here and put back afterwards. Nothing is spawned,
+    // exported or applied to live surfaces meanwhile. The live binds are kept aside as-is, a held one points into them.
+    const auto LIVECONFIG          = takeSnapshot();
+    const auto LIVEANIMATIONS      = animationConfig;
+    const auto LIVEWORKSPACES      = m_mDefaultWorkspaces;
+    const auto LIVEBOUNDWORKSPACES = boundWorkspaces;
+    const auto LIVESUBMAP          = m_szCurrentSubmap;
+    auto       liveBeziers         = g_pAnimationManager->getAllBeziers();
+    auto       liveBinds           = std::move(g_pKeybindManager->m_lKeybinds);
+    const auto LIVEACTIVEBIND      = g_pKeybindManager->m_pActiveKeybind;
+    const auto RECORDED            = m_vRecordedKeywords;
+
+    std::unordered_map<HANDLE, std::unordered_map<std::string, SConfigValue>> livePluginConfigs;
+    for (auto& [handle, pMap] : pluginConfigs)
+        livePluginConfigs[handle] = *pMap;
+
+    m_bNoSideEffects = true;
+    m_bIsReloading   = true; // no rule cache invalidation or layer rule application per keyword
+
+    const auto APPLYBEGIN = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations && ok; ++i) {
+        clearParsedConfig();
+
+        for (auto& entry : RECORDED) {
+            currentCategory   = entry.category;
+            configCurrentPath = entry.path;
+            parseKeyword(entry.command, entry.value);
+        }
+    }
+    const float APPLYMS = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - APPLYBEGIN).count() / 1000.f / iterations;
+
+    m_bNoSideEffects = false;
+    m_bIsReloading   = false;
+
+    // put the live config back as it was, runtime keyword overrides included. Nothing is re-read from disk.
+    restoreSnapshot(LIVECONFIG);
+
+    for (auto& [name, config] : LIVEANIMATIONS)
+        animationConfig[name] = config; // in place, animated variables point at the entries
+
+    for (auto& [handle, values] : livePluginConfigs) {
+        if (const auto IT = pluginConfigs.find(handle); IT != pluginConfigs.end())
+            *IT->second = values;
+    }
+
+    m_mDefaultWorkspaces = LIVEWORKSPACES;
+    boundWorkspaces      = LIVEBOUNDWORKSPACES;
+    m_szCurrentSubmap    = LIVESUBMAP;
+    g_pAnimationManager->restoreBeziers(std::move(liveBeziers));
+
+    g_pKeybindManager->clearKeybinds();
+    g_pKeybindManager->m_lKeybinds      = std::move(liveBinds);
+    g_pKeybindManager->m_pActiveKeybind = LIVEACTIVEBIND;
+
+    configPaths       = PATHS;
+    configModifyTimes = MODIFYTIMES;
+    configDynamicVars = DYNAMICVARS;
+    currentCategory   = CATEGORY;
+    configCurrentPath = CURRENTPATH;
+    parseError        = PARSEERROR;
+    m_vRecordedKeywords.clear();
+    m_vRecordedEnv.clear();
+
+    if (!ok)
+        return "couldn't write or read back the snapshot, see the log";
+
+    return getFormat("config: %s\n\tfiles: %lu\n\tkeywords: %lu\n\titerations: %i\n\tcold parse: %.3fms\n\tsnapshot load: %.3fms\n\tapply: %.3fms\n\tstartup from the "
+                     "config: %.3fms\n\tstartup from the snapshot: %.3fms\n\tspeedup: %.2fx\n",
+                     MAINPATH.c_str(), FILES, KEYWORDS, iterations, COLDMS, CACHEMS, APPLYMS, COLDMS + APPLYMS, CACHEMS + APPLYMS,
+                     CACHEMS + APPLYMS > 0 ? (COLDMS + APPLYMS) / (CACHEMS + APPLYMS) : 0.f);
+}
+
 std::mutex   configmtx;
 SConfigValue CConfigManager::getConfigValueSafe(const std::string& val) {
     std::lock_guard<std::mutex> lg(configmtx);
 
-    SConfigValue                copy = configValues[val];
+    SConfigValue                copy = *getConfigValuePtr(val);
 
     return copy;
 }
 
-SConfigValue CConfigManager::getConfigValueSafeDevice(const std::string& dev, const std::string& val) {
+// device vars that are not set explicitly fall back to input:<section>: of their device type first, then to input:
+static const std::unordered_map<std::string, eConfigKey>& getDeviceFallbackKeys(const std::string& section) {
+    static std::unordered_map<std::string, std::unordered_map<std::string, eConfigKey>> fallbacksBySection;
+
+    const auto IT = fallbacksBySection.find(section);
+    if (IT != fallbacksBySection.end())
+        return IT->second;
+
+    auto& fallbacks = fallbacksBySection[section];
+
+    for (const auto& PREFIX : {section.empty() ? std::string("input:") : "input:" + section + ":", std::string("input:")}) {
+        for (size_t i = 0; i < CFG_KEYS_COUNT; ++i) {
+            const std::string NAME = CONFIG_KEY_INFO[i].name;
+
+            if (NAME.find(PREFIX) != 0)
+                continue;
+
+            const auto VAR = NAME.substr(PREFIX.length());
+
+            if (VAR.find(':') == std::string::npos)
+                fallbacks.emplace(VAR, (eConfigKey)i); // emplace keeps the device section over input:
+        }
+    }
+
+    return fallbacks;
+}
+
+SConfigValue CConfigManager::getConfigValueSafeDevice(const std::string& dev, const std::string& val, const std::string& fallbackSection) {
     std::lock_guard<std::mutex> lg(configmtx);
 
     const auto                  it = deviceConfigs.find(dev);
@@ -1494,16 +2211,11 @@ SConfigValue CConfigManager::getConfigValueSafeDevice(const std::string& dev, co
 
     // fallback if not set explicitly
     if (!copy.set) {
-        for (auto& cv : configValues) {
-            auto foundIt = cv.first.find(val);
-            if (foundIt == std::string::npos)
-                continue;
+        const auto& FALLBACKS = getDeviceFallbackKeys(fallbackSection);
+        const auto  FALLBACK  = FALLBACKS.find(val);
 
-            if (cv.first == "input:" + val || cv.first == "input:touchpad:" + cv.first || cv.first == "input:touchdevice:" + val || cv.first == "input:tablet:" + cv.first ||
-                cv.first == "input:tablet:" + val) {
-                copy = cv.second;
-            }
-        }
+        if (FALLBACK != FALLBACKS.end())
+            copy = configValues[FALLBACK->second];
     }
 
     return copy;
@@ -1526,16 +2238,33 @@ std::string CConfigManager::getString(const std::string& v) {
     return VAL;
 }
 
-int CConfigManager::getDeviceInt(const std::string& dev, const std::string& v) {
-    return getConfigValueSafeDevice(dev, v).intValue;
+int CConfigManager::getInt(eConfigKey key) {
+    return configValues[key].intValue;
+}
+
+float CConfigManager::getFloat(eConfigKey key) {
+    return configValues[key].floatValue;
+}
+
+std::string CConfigManager::getString(eConfigKey key) {
+    const auto& VAL = configValues[key].strValue;
+
+    if (VAL == STRVAL_EMPTY)
+        return "";
+
+    return VAL;
+}
+
+int CConfigManager::getDeviceInt(const std::string& dev, const std::string& v, const std::string& fallbackSection) {
+    return getConfigValueSafeDevice(dev, v, fallbackSection).intValue;
 }
 
-float CConfigManager::getDeviceFloat(const std::string& dev, const std::string& v) {
-    return getConfigValueSafeDevice(dev, v).floatValue;
+float CConfigManager::getDeviceFloat(const std::string& dev, const std::string& v, const std::string& fallbackSection) {
+    return getConfigValueSafeDevice(dev, v, fallbackSection).floatValue;
 }
 
-std::string CConfigManager::getDeviceString(const std::string& dev, const std::string& v) {
-    auto VAL = getConfigValueSafeDevice(dev, v).strValue;
+std::string CConfigManager::getDeviceString(const std::string& dev, const std::string& v, const std::string& fallbackSection) {
+    auto VAL = getConfigValueSafeDevice(dev, v, fallbackSection).strValue;
 
     if (VAL == STRVAL_EMPTY)
         return "";
@@ -1544,15 +2273,15 @@ std::string CConfigManager::getDeviceString(const std::string& dev, const std::s
 }
 
 void CConfigManager::setInt(const std::string& v, int val) {
-    configValues[v].intValue = val;
+    getConfigValuePtr(v)->intValue = val;
 }
 
 void CConfigManager::setFloat(const std::string& v, float val) {
-    configValues[v].floatValue = val;
+    getConfigValuePtr(v)->floatValue = val;
 }
 
 void CConfigManager::setString(const std::string& v, const std::string& val) {
-    configValues[v].strValue = val;
+    getConfigValuePtr(v)->strValue = val;
 }
 
 SMonitorRule CConfigManager::getMonitorRuleFor(const std::string& name, const std::string& displayName) {
@@ -1596,6 +2325,44 @@ std::vector<SWindowRule> CConfigManager::getMatchingRules(CWindow* pWindow) {
     std::string              title      = g_pXWaylandManager->getTitle(pWindow);
     std::string              appidclass = g_pXWaylandManager->getAppIDClass(pWindow);
 
+    SWindowRuleMatchKey      cacheKey = {appidclass, title, pWindow->m_bIsX11, pWindow->m_bIsFloating, pWindow->m_bIsFullscreen, pWindow->m_bPinned};
+
+    if (const auto IT = m_mWindowRuleCache.find(cacheKey); IT != m_mWindowRuleCache.end()) {
+        m_iRuleCacheHits++;
+        returns = IT->second;
+    } else {
+        m_iRuleCacheMisses++;
+        returns = matchWindowRules(pWindow, appidclass, title);
+
+        if (m_dWindowRuleCacheOrder.size() >= WINDOWRULE_CACHE_MAX_ENTRIES) {
+            m_mWindowRuleCache.erase(m_dWindowRuleCacheOrder.front());
+            m_dWindowRuleCacheOrder.pop_front();
+        }
+
+        m_mWindowRuleCache[cacheKey] = returns;
+        m_dWindowRuleCacheOrder.emplace_back(std::move(cacheKey));
+    }
+
+    // exec rules are tied to a PID and consumed on use, never cache them
+    const uint64_t PID          = pWindow->getPID();
+    bool           anyExecFound = false;
+
+    for (auto& er : execRequestedRules) {
+        if (er.iPid == PID) {
+            returns.push_back({er.szRule, "execRule"});
+            anyExecFound = true;
+        }
+    }
+
+    if (anyExecFound) // remove exec rules to unclog searches in the future, why have the garbage here.
+        execRequestedRules.erase(std::remove_if(execRequestedRules.begin(), execRequestedRules.end(), [&](const SExecRequestedRule& other) { return other.iPid == PID; }));
+
+    return returns;
+}
+
+std::vector<SWindowRule> CConfigManager::matchWindowRules(CWindow* pWindow, const std::string& appidclass, const std::string& title) {
+    std::vector<SWindowRule> returns;
+
     Debug::log(LOG, "Searching for matching rules for %s (title: %s)", appidclass.c_str(), title.c_str());
 
     for (auto& rule : m_dWindowRules) {
@@ -1665,20 +2432,16 @@ std::vector<SWindowRule> CConfigManager::getMatchingRules(CWindow* pWindow) {
         returns.push_back(rule);
     }
 
-    const uint64_t PID          = pWindow->getPID();
-    bool           anyExecFound = false;
-
-    for (auto& er : execRequestedRules) {
-        if (er.iPid == PID) {
-            returns.push_back({er.szRule, "execRule"});
-            anyExecFound = true;
-        }
-    }
+    return returns;
+}
 
-    if (anyExecFound) // remove exec rules to unclog searches in the future, why have the garbage here.
-        execRequestedRules.erase(std::remove_if(execRequestedRules.begin(), execRequestedRules.end(), [&](const SExecRequestedRule& other) { return other.iPid == PID; }));
+void CConfigManager::invalidateRuleCache() {
+    m_mWindowRuleCache.clear();
+    m_dWindowRuleCacheOrder.clear();
+}
 
-    return returns;
+size_t CConfigManager::getRuleCacheSize() {
+    return m_mWindowRuleCache.size();
 }
 
 std::vector<SLayerRule> CConfigManager::getMatchingRules(SLayerSurface* pLS) {
@@ -1743,6 +2506,10 @@ void CConfigManager::dispatchExecOnce() {
 }
 
 void CConfigManager::performMonitorReload() {
+    if (g_pCompositor->m_sTransaction.depth > 0) {
+        g_pCompositor->m_sTransaction.reloadMonitors = true;
+        return;
+    }
 
     bool overAgain = false;
 
@@ -1772,14 +2539,34 @@ void CConfigManager::performMonitorReload() {
     m_bWantsMonitorReload = false;
 }
 
+eConfigKey CConfigManager::findConfigKey(const std::string& val) {
+    const auto IT = configKeyIndex.find(val);
+
+    return IT == configKeyIndex.end() ? CFG_KEYS_COUNT : IT->second;
+}
+
+SConfigValue* CConfigManager::getConfigValuePtr(eConfigKey key) {
+    return &configValues[key];
+}
+
 SConfigValue* CConfigManager::getConfigValuePtr(const std::string& val) {
-    return &configValues[val];
+    if (const auto PVAL = getConfigValuePtrSafe(val); PVAL)
+        return PVAL;
+
+    // keep the old semantics of handing out a valid (but meaningless) value for undeclared names
+    const auto IT = unknownConfigValues.find(val);
+    if (IT != unknownConfigValues.end())
+        return &IT->second;
+
+    Debug::log(ERR, "getConfigValuePtr: no such config value: %s", val.c_str());
+
+    return &unknownConfigValues[val];
 }
 
 SConfigValue* CConfigManager::getConfigValuePtrSafe(const std::string& val) {
-    const auto IT = configValues.find(val);
+    const auto KEY = findConfigKey(val);
 
-    if (IT == configValues.end()) {
+    if (KEY == CFG_KEYS_COUNT) {
         // maybe plugin
         for (auto& [pl, pMap] : pluginConfigs) {
             const auto PLIT = pMap->find(val);
@@ -1791,7 +2578,7 @@ SConfigValue* CConfigManager::getConfigValuePtrSafe(const std::string& val) {
         return nullptr;
     }
 
-    return &(IT->second);
+    return &configValues[KEY];
 }
 
 bool CConfigManager::deviceConfigExists(const std::string& dev) {
@@ -1828,7 +2615,7 @@ void CConfigManager::ensureMonitorStatus() {
 }
 
 void CConfigManager::ensureVRR(CMonitor* pMonitor) {
-    static auto* const PVRR = &getConfigValuePtr("misc:vrr")->intValue;
+    static auto* const PVRR = &getConfigValuePtr(CFG_MISC_VRR)->intValue;
 
     static auto        ensureVRRForDisplay = [&](CMonitor* m) -> void {
         if (!m->output)
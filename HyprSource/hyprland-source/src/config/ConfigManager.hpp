@@ -10,11 +10,13 @@
 #include <deque>
 #include <algorithm>
 #include <regex>
+#include <unordered_set>
 #include "../Window.hpp"
 #include "../helpers/WLClasses.hpp"
 
 #include "defaultConfig.hpp"
 #include "ConfigDataValues.hpp"
+#include "ConfigKeys.hpp"
 
 #define STRVAL_EMPTY "[[EMPTY]]"
 
@@ -23,6 +25,11 @@
 
 #define HANDLE void*
 
+#define WINDOWRULE_CACHE_MAX_ENTRIES 256
+#define CONFIG_RELOAD_DEBOUNCE_MS    100
+#define CONFIG_CACHE_VERSION         2
+#define CONFIGBENCH_MAX_ITERATIONS   100
+
 struct SConfigValue {
     int64_t                                 intValue   = -INT64_MAX;
     float                                   floatValue = -__FLT_MAX__;
@@ -43,6 +50,8 @@ struct SMonitorRule {
     wl_output_transform transform   = WL_OUTPUT_TRANSFORM_NORMAL;
     std::string         mirrorOf    = "";
     bool                enable10bit = false;
+
+    bool                operator==(const SMonitorRule&) const = default;
 };
 
 struct SMonitorAdditionalReservedArea {
@@ -50,6 +59,8 @@ struct SMonitorAdditionalReservedArea {
     int bottom = 0;
     int left   = 0;
     int right  = 0;
+
+    bool operator==(const SMonitorAdditionalReservedArea&) const = default;
 };
 
 struct SAnimationPropertyConfig {
@@ -64,6 +75,78 @@ struct SAnimationPropertyConfig {
     SAnimationPropertyConfig* pParentAnimation = nullptr;
 };
 
+struct SWindowRuleMatchKey {
+    std::string szClass     = "";
+    std::string szTitle     = "";
+    bool        bX11        = false;
+    bool        bFloating   = false;
+    bool        bFullscreen = false;
+    bool        bPinned     = false;
+
+    bool        operator==(const SWindowRuleMatchKey&) const = default;
+};
+
+struct SWindowRuleMatchKeyHash {
+    size_t operator()(const SWindowRuleMatchKey& key) const {
+        size_t seed = std::hash<std::string>{}(key.szClass);
+        seed ^= std::hash<std::string>{}(key.szTitle) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed ^ (key.bX11 | (key.bFloating << 1) | (key.bFullscreen << 2) | (key.bPinned << 3));
+    }
+};
+
+// what changed between two consecutive parses of the config, see loadConfigLoadVars
+struct SConfigDiff {
+    bool layout       = false; // gaps, borders, general:layout, dwindle: and master:
+    bool decoration   = false; // decoration: and general:col.*
+    bool blur         = false;
+    bool screenShader = false;
+    bool input        = false; // input: and device configs
+    bool monitors     = false; // monitor rules and reserved areas
+    bool vrr          = false;
+    bool binds        = false;
+    bool windowRules  = false;
+    bool layerRules   = false; // layer rules and blurls
+    bool other        = false;
+
+    bool visual() const {
+        return layout || decoration || blur || screenShader || monitors || windowRules || layerRules || other;
+    }
+};
+
+// everything loadConfigLoadVars resets, kept around to compute a SConfigDiff
+struct SConfigSnapshot {
+    std::array<SConfigValue, CFG_KEYS_COUNT>                                       values;
+    std::unordered_map<std::string, std::unordered_map<std::string, SConfigValue>> deviceConfigs;
+    std::deque<SMonitorRule>                                                       monitorRules;
+    std::unordered_map<std::string, SMonitorAdditionalReservedArea>                reservedAreas;
+    std::deque<SWindowRule>                                                        windowRules;
+    std::deque<SLayerRule>                                                         layerRules;
+    std::deque<std::string>                                                        blurLSNamespaces;
+};
+
+// a keyword as parseLine passed it to parseKeyword, with sources and variables already resolved
+struct SConfigCacheEntry {
+    std::string category = "";
+    std::string command  = "";
+    std::string value    = "";
+    std::string path     = ""; // configCurrentPath at the time, relative paths in the value resolve against it
+};
+
+struct SConfigCacheFile {
+    std::string path  = "";
+    int64_t     mtime = 0; // in ns
+    uint64_t    size  = 0;
+    uint64_t    hash  = 0; // FNV-1a of the contents
+};
+
+// startup snapshot of the parsed config, see loadConfigLoadVars
+struct SConfigCache {
+    std::string                                      mainPath = "";
+    std::vector<SConfigCacheFile>                    files; // in configPaths order
+    std::vector<std::pair<std::string, std::string>> env;   // environment variables substituted into the config
+    std::vector<SConfigCacheEntry>                   entries;
+};
+
 struct SExecRequestedRule {
     std::string szRule = "";
     uint64_t    iPid   = 0;
@@ -139,15 +222,21 @@ class CConfigManager {
     void                                                            setInt(const std::string&, int);
     void                                                            setString(const std::string&, const std::string&);
 
-    int                                                             getDeviceInt(const std::string&, const std::string&);
-    float                                                           getDeviceFloat(const std::string&, const std::string&);
-    std::string                                                     getDeviceString(const std::string&, const std::string&);
+    int                                                             getDeviceInt(const std::string&, const std::string&, const std::string& fallbackSection = "");
+    float                                                           getDeviceFloat(const std::string&, const std::string&, const std::string& fallbackSection = "");
+    std::string                                                     getDeviceString(const std::string&, const std::string&, const std::string& fallbackSection = "");
     bool                                                            deviceConfigExists(const std::string&);
     bool                                                            shouldBlurLS(const std::string&);
 
     SConfigValue*                                                   getConfigValuePtr(const std::string&);
     SConfigValue*                                                   getConfigValuePtrSafe(const std::string&);
 
+    // typed accessors, prefer these over the string ones outside of IPC and plugins
+    int                                                             getInt(eConfigKey);
+    float                                                           getFloat(eConfigKey);
+    std::string                                                     getString(eConfigKey);
+    SConfigValue*                                                   getConfigValuePtr(eConfigKey);
+
     SMonitorRule                                                    getMonitorRuleFor(const std::string&, const std::string& displayName = "");
     std::string                                                     getDefaultWorkspaceFor(const std::string&);
 
@@ -184,12 +273,27 @@ class CConfigManager {
 
     std::string               configCurrentPath;
 
+    // window rule match cache stats, reported by hyprctl rulecache
+    uint64_t                  m_iRuleCacheHits   = 0;
+    uint64_t                  m_iRuleCacheMisses = 0;
+    size_t                    getRuleCacheSize();
+    void                      invalidateRuleCache();
+
+    // false if inotify is unavailable and the config has to be polled with tick()
+    bool                      isWatchingConfig();
+    void                      scheduleReload();
+
+    // times parsing and applying the config against loading it from a snapshot and applying that, for hyprctl configbench
+    std::string               benchmarkConfigCache(int iterations, const std::string& path);
+
   private:
     std::deque<std::string>                                                                    configPaths;       // stores all the config paths
     std::unordered_map<std::string, time_t>                                                    configModifyTimes; // stores modify times
     std::vector<std::pair<std::string, std::string>>                                           configDynamicVars; // stores dynamic vars declared by the user
-    std::unordered_map<std::string, SConfigValue>                                              configValues;
-    std::unordered_map<std::string, std::unordered_map<std::string, SConfigValue>>             deviceConfigs; // stores device configs
+    std::array<SConfigValue, CFG_KEYS_COUNT>                                                   configValues;
+    std::unordered_map<std::string, eConfigKey>                                                configKeyIndex;      // name -> key, built once from CONFIG_KEYS
+    std::unordered_map<std::string, SConfigValue>                                              unknownConfigValues; // for getConfigValuePtr on undeclared names
+    std::unordered_map<std::string, std::unordered_map<std::string, SConfigValue>>             deviceConfigs;       // stores device configs
 
     std::unordered_map<std::string, SAnimationPropertyConfig>                                  animationConfig; // stores all the animations with their set values
 
@@ -210,6 +314,8 @@ class CConfigManager {
     std::deque<SMonitorRule>                                                                   m_dMonitorRules;
     std::unordered_map<std::string, std::string>                                               m_mDefaultWorkspaces;
     std::deque<SWindowRule>                                                                    m_dWindowRules;
+    std::unordered_map<SWindowRuleMatchKey, std::vector<SWindowRule>, SWindowRuleMatchKeyHash> m_mWindowRuleCache;      // memoized getMatchingRules results
+    std::deque<SWindowRuleMatchKey>                                                            m_dWindowRuleCacheOrder; // insertion order, for eviction
     std::deque<SLayerRule>                                                                     m_dLayerRules;
     std::deque<std::string>                                                                    m_dBlurLSNamespaces;
 
@@ -229,9 +335,10 @@ class CConfigManager {
     void         updateBlurredLS(const std::string&, const bool);
 
     void         applyUserDefinedVars(std::string&, const size_t);
-    void         loadConfigLoadVars();
+    void         loadConfigLoadVars(bool fullApply = true);
+    eConfigKey   findConfigKey(const std::string&);
     SConfigValue getConfigValueSafe(const std::string&);
-    SConfigValue getConfigValueSafeDevice(const std::string&, const std::string&);
+    SConfigValue getConfigValueSafeDevice(const std::string&, const std::string&, const std::string&);
     void         parseLine(std::string&);
     void         configSetValueSafe(const std::string&, const std::string&);
     void         handleDeviceConfig(const std::string&, const std::string&);
@@ -250,6 +357,44 @@ class CConfigManager {
     void         handleBlurLS(const std::string&, const std::string&);
     void         handleBindWS(const std::string&, const std::string&);
     void         handleEnv(const std::string&, const std::string&);
+
+    // incremental reload
+    void                     clearParsedConfig(); // back to the defaults, before parsing
+    SConfigSnapshot          takeSnapshot();
+    void                     restoreSnapshot(const SConfigSnapshot&);
+    SConfigDiff              diffAgainst(const SConfigSnapshot&);
+    bool                     m_bIsReloading             = false;
+    std::string              m_szScreenShaderPath       = "";
+    bool                     m_bScreenShaderFileChanged = false;
+
+    // config file watching
+    int                                  m_iConfigWatchFD       = -1;
+    wl_event_source*                     m_pConfigWatchSource   = nullptr;
+    wl_event_source*                     m_pConfigDebounceTimer = nullptr;
+    std::unordered_map<int, std::string> m_mConfigWatchDirs; // watch descriptor -> directory
+    std::unordered_set<std::string>      m_sConfigWatchFiles;
+    std::unordered_set<std::string>      m_sConfigWatchMissingDirs; // watched through their closest existing parent until they reappear
+
+    void                                 startConfigWatcher();
+    void                                 updateConfigWatches();
+    static int                           onConfigWatchEvent(int fd, uint32_t mask, void* data);
+    static int                           onConfigDebounceTimer(void* data);
+
+    // startup config cache
+    bool                                             m_bRecordingKeywords = false;
+    bool                                             m_bDryParse          = false; // only follow sources and $vars, for benchmarking
+    bool                                             m_bNoSideEffects     = false; // keywords only change the config, nothing is spawned or pushed to live surfaces, for benchmarking
+    std::vector<SConfigCacheEntry>                   m_vRecordedKeywords;
+    std::vector<std::pair<std::string, std::string>> m_vRecordedEnv;
+
+    std::string                                      getConfigCachePath();
+    bool                                             readConfigCache(const std::string& cachePath, const std::string& mainPath, SConfigCache& cache);
+    bool                                             writeConfigCache(const std::string& cachePath, const std::string& mainPath);
+    void                                             replayConfigCache(const SConfigCache& cache);
+    void                                             dryParseFile(const std::string& path);
+
+    // uncached rule matching, use getMatchingRules
+    std::vector<SWindowRule> matchWindowRules(CWindow*, const std::string&, const std::string&);
 };
 
 inline std::unique_ptr<CConfigManager> g_pConfigManager;
@@ -0,0 +1,53 @@
+#include "Allocations.hpp"
+
+#ifdef HYPRLAND_COUNT_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+static thread_local size_t allocations = 0;
+
+size_t Allocations::threadCount() {
+    return allocations;
+}
+
+// libstdc++ routes the nothrow and sized variants through these, aligned ones aren't counted
+void* operator new(size_t size) {
+    allocations++;
+
+    if (size == 0)
+        size = 1;
+
+    while (true) {
+        if (void* p = malloc(size))
+            return p;
+
+        const auto HANDLER = std::get_new_handler();
+        if (!HANDLER)
+            throw std::bad_alloc();
+
+        HANDLER();
+    }
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    free(p);
+}
+
+#endif
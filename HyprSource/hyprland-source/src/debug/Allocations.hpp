@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+// with HYPRLAND_COUNT_ALLOCATIONS (COUNT_ALLOCATIONS in cmake, count_allocations in meson), global operator new is replaced
+// to count allocations per thread, a thread_local increment is all it adds. the in-compositor benchmarks diff the count around what they time.
+#ifdef HYPRLAND_COUNT_ALLOCATIONS
+namespace Allocations {
+    size_t threadCount(); // operator new calls made by the calling thread so far
+};
+#endif
@@ -126,6 +126,8 @@ void CrashReporter::createAndSaveCrash(int sig) {
 
     finalCrashReport += "\n\nLog tail:\n";
 
+    Debug::emergencyFlush();
+
     finalCrashReport += execAndGet(("cat \"" + Debug::logFile + "\" | tail -n 50").c_str());
 
     const auto HOME = getenv("HOME");
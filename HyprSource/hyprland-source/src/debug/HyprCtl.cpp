@@ -1,4 +1,6 @@
 #include "HyprCtl.hpp"
+#include "HyprCtlSnapshot.hpp"
+#include "../helpers/JSONWriter.hpp"
 
 #include <netinet/in.h>
 #include <stdio.h>
@@ -10,302 +12,244 @@
 #include <sys/un.h>
 #include <unistd.h>
 #include <errno.h>
+#include <sys/eventfd.h>
 
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <sstream>
 #include <string>
 
-std::string monitorsRequest(HyprCtl::eHyprCtlOutputFormat format) {
+std::string monitorsRequest(const SHyprCtlSnapshot& snapshot, HyprCtl::eHyprCtlOutputFormat format) {
     std::string result = "";
     if (format == HyprCtl::FORMAT_JSON) {
-        result += "[";
-
-        for (auto& m : g_pCompositor->m_vMonitors) {
-            if (!m->output)
-                continue;
-
-            result += getFormat(
-                R"#({
-    "id": %i,
-    "name": "%s",
-    "description": "%s",
-    "make": "%s",
-    "model": "%s",
-    "serial": "%s",
-    "width": %i,
-    "height": %i,
-    "refreshRate": %f,
-    "x": %i,
-    "y": %i,
-    "activeWorkspace": {
-        "id": %i,
-        "name": "%s"
-    },
-    "reserved": [%i, %i, %i, %i],
-    "scale": %.2f,
-    "transform": %i,
-    "focused": %s,
-    "dpmsStatus": %s,
-    "vrr": %s
-},)#",
-                m->ID, escapeJSONStrings(m->szName).c_str(), escapeJSONStrings(m->output->description ? m->output->description : "").c_str(),
-                (m->output->make ? m->output->make : ""), (m->output->model ? m->output->model : ""), (m->output->serial ? m->output->serial : ""), (int)m->vecPixelSize.x,
-                (int)m->vecPixelSize.y, m->refreshRate, (int)m->vecPosition.x, (int)m->vecPosition.y, m->activeWorkspace,
-                escapeJSONStrings(g_pCompositor->getWorkspaceByID(m->activeWorkspace)->m_szName).c_str(), (int)m->vecReservedTopLeft.x, (int)m->vecReservedTopLeft.y,
-                (int)m->vecReservedBottomRight.x, (int)m->vecReservedBottomRight.y, m->scale, (int)m->transform, (m.get() == g_pCompositor->m_pLastMonitor ? "true" : "false"),
-                (m->dpmsStatus ? "true" : "false"), (m->output->adaptive_sync_status == WLR_OUTPUT_ADAPTIVE_SYNC_ENABLED ? "true" : "false"));
+        CJSONWriter json(result);
+        json.beginArray();
+
+        for (auto& m : snapshot.monitors) {
+            json.beginObject();
+            json.key("id").integer(m.id);
+            json.key("name").string(m.name);
+            json.key("description").string(m.description);
+            json.key("make").string(m.make);
+            json.key("model").string(m.model);
+            json.key("serial").string(m.serial);
+            json.key("width").integer((int)m.pixelSize.x);
+            json.key("height").integer((int)m.pixelSize.y);
+            json.key("refreshRate").number(m.refreshRate);
+            json.key("x").integer((int)m.position.x);
+            json.key("y").integer((int)m.position.y);
+            json.key("activeWorkspace").beginObject();
+            json.key("id").integer(m.activeWorkspace);
+            json.key("name").string(m.activeWorkspaceName);
+            json.endObject();
+            json.key("reserved").beginArray(true);
+            json.integer((int)m.reservedTopLeft.x).integer((int)m.reservedTopLeft.y);
+            json.integer((int)m.reservedBottomRight.x).integer((int)m.reservedBottomRight.y);
+            json.endArray();
+            json.key("scale").number(m.scale, 2);
+            json.key("transform").integer(m.transform);
+            json.key("focused").boolean(m.focused);
+            json.key("dpmsStatus").boolean(m.dpms);
+            json.key("vrr").boolean(m.vrr);
+            json.endObject();
         }
 
-        // remove trailing comma
-        result.pop_back();
-
-        result += "]";
+        json.endArray();
     } else {
-        for (auto& m : g_pCompositor->m_vMonitors) {
-            if (!m->output)
-                continue;
-
+        for (auto& m : snapshot.monitors) {
             result += getFormat("Monitor %s (ID %i):\n\t%ix%i@%f at %ix%i\n\tdescription: %s\n\tmake: %s\n\tmodel: %s\n\tserial: %s\n\tactive workspace: %i (%s)\n\treserved: %i "
                                 "%i %i %i\n\tscale: %.2f\n\ttransform: "
                                 "%i\n\tfocused: %s\n\tdpmsStatus: %i\n\tvrr: %i\n\n",
-                                m->szName.c_str(), m->ID, (int)m->vecPixelSize.x, (int)m->vecPixelSize.y, m->refreshRate, (int)m->vecPosition.x, (int)m->vecPosition.y,
-                                (m->output->description ? m->output->description : ""), (m->output->make ? m->output->make : ""), (m->output->model ? m->output->model : ""),
-                                (m->output->serial ? m->output->serial : ""), m->activeWorkspace, g_pCompositor->getWorkspaceByID(m->activeWorkspace)->m_szName.c_str(),
-                                (int)m->vecReservedTopLeft.x, (int)m->vecReservedTopLeft.y, (int)m->vecReservedBottomRight.x, (int)m->vecReservedBottomRight.y, m->scale,
-                                (int)m->transform, (m.get() == g_pCompositor->m_pLastMonitor ? "yes" : "no"), (int)m->dpmsStatus,
-                                (int)(m->output->adaptive_sync_status == WLR_OUTPUT_ADAPTIVE_SYNC_ENABLED));
+                                m.name.c_str(), m.id, (int)m.pixelSize.x, (int)m.pixelSize.y, m.refreshRate, (int)m.position.x, (int)m.position.y, m.description.c_str(),
+                                m.make.c_str(), m.model.c_str(), m.serial.c_str(), m.activeWorkspace, m.activeWorkspaceName.c_str(), (int)m.reservedTopLeft.x,
+                                (int)m.reservedTopLeft.y, (int)m.reservedBottomRight.x, (int)m.reservedBottomRight.y, m.scale, m.transform, (m.focused ? "yes" : "no"), (int)m.dpms,
+                                (int)m.vrr);
         }
     }
 
     return result;
 }
 
-static std::string getGroupedData(CWindow* w, HyprCtl::eHyprCtlOutputFormat format) {
-    const bool isJson = format == HyprCtl::FORMAT_JSON;
-    if (!w->m_sGroupData.pNextWindow)
-        return isJson ? "" : "0";
-
-    std::vector<CWindow*> groupMembers;
+static std::string getGroupedData(const SWindowSnapshot& w) {
+    if (w.grouped.empty())
+        return "0";
 
-    CWindow*              curr = w;
-    do {
-        groupMembers.push_back(curr);
-        curr = curr->m_sGroupData.pNextWindow;
-    } while (curr != w);
-
-    const auto         comma = isJson ? ", " : ",";
-    const auto         fmt   = isJson ? "\"0x%x\"" : "%x";
     std::ostringstream result;
 
-    bool               first = true;
-    for (auto& gw : groupMembers) {
-        if (first)
-            first = false;
-        else
-            result << comma;
+    for (auto& gw : w.grouped) {
+        if (gw != w.grouped.front())
+            result << ",";
 
-        result << getFormat(fmt, gw);
+        result << getFormat("%x", gw);
     }
 
     return result.str();
 }
 
-static std::string getWindowData(CWindow* w, HyprCtl::eHyprCtlOutputFormat format) {
-    if (format == HyprCtl::FORMAT_JSON) {
-        return getFormat(
-            R"#({
-    "address": "0x%x",
-    "mapped": %s,
-    "hidden": %s,
-    "at": [%i, %i],
-    "size": [%i, %i],
-    "workspace": {
-        "id": %i,
-        "name": "%s"
-    },
-    "floating": %s,
-    "monitor": %i,
-    "class": "%s",
-    "title": "%s",
-    "initialClass": "%s",
-    "initialTitle": "%s",
-    "pid": %i,
-    "xwayland": %s,
-    "pinned": %s,
-    "fullscreen": %s,
-    "fullscreenMode": %i,
-    "fakeFullscreen": %s,
-    "grouped": [%s],
-    "swallowing": %s
-},)#",
-            w, (w->m_bIsMapped ? "true" : "false"), (w->isHidden() ? "true" : "false"), (int)w->m_vRealPosition.goalv().x, (int)w->m_vRealPosition.goalv().y,
-            (int)w->m_vRealSize.goalv().x, (int)w->m_vRealSize.goalv().y, w->m_iWorkspaceID,
-            escapeJSONStrings(w->m_iWorkspaceID == -1                                ? "" :
-                                  g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID) ? g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID)->m_szName :
-                                                                                       std::string("Invalid workspace " + std::to_string(w->m_iWorkspaceID)))
-                .c_str(),
-            ((int)w->m_bIsFloating == 1 ? "true" : "false"), w->m_iMonitorID, escapeJSONStrings(g_pXWaylandManager->getAppIDClass(w)).c_str(),
-            escapeJSONStrings(g_pXWaylandManager->getTitle(w)).c_str(), escapeJSONStrings(w->m_szInitialClass).c_str(), escapeJSONStrings(w->m_szInitialTitle).c_str(), w->getPID(),
-            ((int)w->m_bIsX11 == 1 ? "true" : "false"), (w->m_bPinned ? "true" : "false"), (w->m_bIsFullscreen ? "true" : "false"),
-            (w->m_bIsFullscreen ? (g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID) ? g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID)->m_efFullscreenMode : 0) : 0),
-            w->m_bFakeFullscreenState ? "true" : "false", getGroupedData(w, format).c_str(), (w->m_pSwallowed ? getFormat("\"0x%x\"", w->m_pSwallowed).c_str() : "null"));
-    } else {
-        return getFormat(
-            "Window %x -> %s:\n\tmapped: %i\n\thidden: %i\n\tat: %i,%i\n\tsize: %i,%i\n\tworkspace: %i (%s)\n\tfloating: %i\n\tmonitor: %i\n\tclass: %s\n\ttitle: "
-            "%s\n\tinitialClass: %s\n\tinitialTitle: %s\n\tpid: "
-            "%i\n\txwayland: %i\n\tpinned: "
-            "%i\n\tfullscreen: %i\n\tfullscreenmode: %i\n\tfakefullscreen: %i\n\tgrouped: %s\n\tswallowing: %x\n\n",
-            w, w->m_szTitle.c_str(), (int)w->m_bIsMapped, (int)w->isHidden(), (int)w->m_vRealPosition.goalv().x, (int)w->m_vRealPosition.goalv().y, (int)w->m_vRealSize.goalv().x,
-            (int)w->m_vRealSize.goalv().y, w->m_iWorkspaceID,
-            (w->m_iWorkspaceID == -1                                ? "" :
-                 g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID) ? g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID)->m_szName.c_str() :
-                                                                      std::string("Invalid workspace " + std::to_string(w->m_iWorkspaceID)).c_str()),
-            (int)w->m_bIsFloating, w->m_iMonitorID, g_pXWaylandManager->getAppIDClass(w).c_str(), g_pXWaylandManager->getTitle(w).c_str(), w->m_szInitialClass.c_str(),
-            w->m_szInitialTitle.c_str(), w->getPID(), (int)w->m_bIsX11, (int)w->m_bPinned, (int)w->m_bIsFullscreen,
-            (w->m_bIsFullscreen ? (g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID) ? g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID)->m_efFullscreenMode : 0) : 0),
-            (int)w->m_bFakeFullscreenState, getGroupedData(w, format).c_str(), w->m_pSwallowed);
-    }
+static void writeWindowJSON(CJSONWriter& json, const SWindowSnapshot& w) {
+    json.beginObject();
+    json.key("address").address(w.address);
+    json.key("mapped").boolean(w.mapped);
+    json.key("hidden").boolean(w.hidden);
+    json.key("at").beginArray(true).integer((int)w.position.x).integer((int)w.position.y).endArray();
+    json.key("size").beginArray(true).integer((int)w.size.x).integer((int)w.size.y).endArray();
+    json.key("workspace").beginObject();
+    json.key("id").integer(w.workspaceID);
+    json.key("name").string(w.workspaceName);
+    json.endObject();
+    json.key("floating").boolean(w.floating);
+    json.key("monitor").integer(w.monitor);
+    json.key("class").string(w.windowClass);
+    json.key("title").string(w.title);
+    json.key("initialClass").string(w.initialClass);
+    json.key("initialTitle").string(w.initialTitle);
+    json.key("pid").integer(w.pid);
+    json.key("xwayland").boolean(w.xwayland);
+    json.key("pinned").boolean(w.pinned);
+    json.key("fullscreen").boolean(w.fullscreen);
+    json.key("fullscreenMode").integer(w.fullscreenMode);
+    json.key("fakeFullscreen").boolean(w.fakeFullscreen);
+
+    json.key("grouped").beginArray(true);
+    for (auto& gw : w.grouped)
+        json.address(gw);
+    json.endArray();
+
+    json.key("swallowing");
+    if (w.swallowing)
+        json.address(w.swallowing);
+    else
+        json.null();
+
+    json.endObject();
 }
 
-std::string clientsRequest(HyprCtl::eHyprCtlOutputFormat format) {
+static std::string getWindowData(const SWindowSnapshot& w) {
+    return getFormat(
+        "Window %x -> %s:\n\tmapped: %i\n\thidden: %i\n\tat: %i,%i\n\tsize: %i,%i\n\tworkspace: %i (%s)\n\tfloating: %i\n\tmonitor: %i\n\tclass: %s\n\ttitle: "
+        "%s\n\tinitialClass: %s\n\tinitialTitle: %s\n\tpid: "
+        "%i\n\txwayland: %i\n\tpinned: "
+        "%i\n\tfullscreen: %i\n\tfullscreenmode: %i\n\tfakefullscreen: %i\n\tgrouped: %s\n\tswallowing: %x\n\n",
+        w.address, w.title.c_str(), (int)w.mapped, (int)w.hidden, (int)w.position.x, (int)w.position.y, (int)w.size.x, (int)w.size.y, w.workspaceID, w.workspaceName.c_str(),
+        (int)w.floating, w.monitor, w.windowClass.c_str(), w.title.c_str(), w.initialClass.c_str(), w.initialTitle.c_str(), w.pid, (int)w.xwayland, (int)w.pinned,
+        (int)w.fullscreen, w.fullscreenMode, (int)w.fakeFullscreen, getGroupedData(w).c_str(), w.swallowing);
+}
+
+std::string clientsRequest(const SHyprCtlSnapshot& snapshot, HyprCtl::eHyprCtlOutputFormat format) {
     std::string result = "";
     if (format == HyprCtl::FORMAT_JSON) {
-        result += "[";
+        // ~700 bytes per window, one allocation for the whole reply
+        result.reserve(snapshot.windows.size() * 1024);
 
-        for (auto& w : g_pCompositor->m_vWindows) {
-            result += getWindowData(w.get(), format);
-        }
+        CJSONWriter json(result);
+        json.beginArray();
 
-        // remove trailing comma
-        if (result != "[")
-            result.pop_back();
+        for (auto& w : snapshot.windows) {
+            writeWindowJSON(json, w);
+        }
 
-        result += "]";
+        json.endArray();
     } else {
-        for (auto& w : g_pCompositor->m_vWindows) {
-            result += getWindowData(w.get(), format);
+        for (auto& w : snapshot.windows) {
+            result += getWindowData(w);
         }
     }
     return result;
 }
 
-std::string workspacesRequest(HyprCtl::eHyprCtlOutputFormat format) {
+std::string workspacesRequest(const SHyprCtlSnapshot& snapshot, HyprCtl::eHyprCtlOutputFormat format) {
     std::string result = "";
     if (format == HyprCtl::FORMAT_JSON) {
-        result += "[";
-
-        for (auto& w : g_pCompositor->m_vWorkspaces) {
-            const auto PLASTW = w->getLastFocusedWindow();
-
-            result += getFormat(
-                R"#({
-    "id": %i,
-    "name": "%s",
-    "monitor": "%s",
-    "windows": %i,
-    "hasfullscreen": %s,
-    "lastwindow": "0x%x",
-    "lastwindowtitle": "%s"
-},)#",
-                w->m_iID, escapeJSONStrings(w->m_szName).c_str(), escapeJSONStrings(g_pCompositor->getMonitorFromID(w->m_iMonitorID)->szName).c_str(),
-                g_pCompositor->getWindowsOnWorkspace(w->m_iID), ((int)w->m_bHasFullscreenWindow == 1 ? "true" : "false"), PLASTW,
-                PLASTW ? escapeJSONStrings(PLASTW->m_szTitle).c_str() : "");
+        CJSONWriter json(result);
+        json.beginArray();
+
+        for (auto& w : snapshot.workspaces) {
+            json.beginObject();
+            json.key("id").integer(w.id);
+            json.key("name").string(w.name);
+            json.key("monitor").string(w.monitor);
+            json.key("windows").integer(w.windows);
+            json.key("hasfullscreen").boolean(w.hasFullscreen);
+            json.key("lastwindow").address(w.lastWindow);
+            json.key("lastwindowtitle").string(w.lastWindowTitle);
+            json.endObject();
         }
 
-        // remove trailing comma
-        result.pop_back();
-
-        result += "]";
+        json.endArray();
     } else {
-        for (auto& w : g_pCompositor->m_vWorkspaces) {
-            const auto PLASTW = w->getLastFocusedWindow();
-            result += getFormat("workspace ID %i (%s) on monitor %s:\n\twindows: %i\n\thasfullscreen: %i\n\tlastwindow: 0x%x\n\tlastwindowtitle: %s\n\n", w->m_iID,
-                                w->m_szName.c_str(), g_pCompositor->getMonitorFromID(w->m_iMonitorID)->szName.c_str(), g_pCompositor->getWindowsOnWorkspace(w->m_iID),
-                                (int)w->m_bHasFullscreenWindow, PLASTW, PLASTW ? PLASTW->m_szTitle.c_str() : "");
+        for (auto& w : snapshot.workspaces) {
+            result += getFormat("workspace ID %i (%s) on monitor %s:\n\twindows: %i\n\thasfullscreen: %i\n\tlastwindow: 0x%x\n\tlastwindowtitle: %s\n\n", w.id, w.name.c_str(),
+                                w.monitor.c_str(), w.windows, (int)w.hasFullscreen, w.lastWindow, w.lastWindowTitle.c_str());
         }
     }
     return result;
 }
 
-std::string activeWindowRequest(HyprCtl::eHyprCtlOutputFormat format) {
-    const auto PWINDOW = g_pCompositor->m_pLastWindow;
-
-    if (!g_pCompositor->windowValidMapped(PWINDOW))
+std::string activeWindowRequest(const SHyprCtlSnapshot& snapshot, HyprCtl::eHyprCtlOutputFormat format) {
+    if (snapshot.activeWindow < 0)
         return format == HyprCtl::FORMAT_JSON ? "{}" : "Invalid";
 
-    auto result = getWindowData(PWINDOW, format);
+    const auto& WINDOW = snapshot.windows[snapshot.activeWindow];
+
+    if (format != HyprCtl::FORMAT_JSON)
+        return getWindowData(WINDOW);
 
-    if (format == HyprCtl::FORMAT_JSON)
-        result.pop_back();
+    std::string result = "";
+    CJSONWriter json(result);
+    writeWindowJSON(json, WINDOW);
 
     return result;
 }
 
-std::string layersRequest(HyprCtl::eHyprCtlOutputFormat format) {
+std::string layersRequest(const SHyprCtlSnapshot& snapshot, HyprCtl::eHyprCtlOutputFormat format) {
     std::string result = "";
 
     if (format == HyprCtl::FORMAT_JSON) {
-        result += "{\n";
+        CJSONWriter json(result);
+        json.beginObject();
 
-        for (auto& mon : g_pCompositor->m_vMonitors) {
-            result += getFormat(
-                R"#("%s": {
-    "levels": {
-)#",
-                escapeJSONStrings(mon->szName).c_str());
+        for (auto& mon : snapshot.layers) {
+            json.key(mon.monitor).beginObject();
+            json.key("levels").beginObject();
 
             int layerLevel = 0;
-            for (auto& level : mon->m_aLayerSurfaceLayers) {
-                result += getFormat(
-                    R"#(
-        "%i": [
-)#",
-                    layerLevel);
+            for (auto& level : mon.levels) {
+                json.key(std::to_string(layerLevel)).beginArray();
+
                 for (auto& layer : level) {
-                    result += getFormat(
-                        R"#(                {
-                    "address": "0x%x",
-                    "x": %i,
-                    "y": %i,
-                    "w": %i,
-                    "h": %i,
-                    "namespace": "%s"
-                },)#",
-                        layer.get(), layer->geometry.x, layer->geometry.y, layer->geometry.width, layer->geometry.height, escapeJSONStrings(layer->szNamespace).c_str());
+                    json.beginObject();
+                    json.key("address").address(layer.address);
+                    json.key("x").integer(layer.x);
+                    json.key("y").integer(layer.y);
+                    json.key("w").integer(layer.w);
+                    json.key("h").integer(layer.h);
+                    json.key("namespace").string(layer.ns);
+                    json.endObject();
                 }
 
-                // remove trailing comma
-                result.pop_back();
-
-                if (level.size() > 0)
-                    result += "\n        ";
-
-                result += "],";
+                json.endArray();
 
                 layerLevel++;
             }
 
-            // remove trailing comma
-            result.pop_back();
-
-            result += "\n    }\n},";
+            json.endObject();
+            json.endObject();
         }
 
-        // remove trailing comma
-        result.pop_back();
-
-        result += "\n}\n";
+        json.endObject();
+        result += "\n";
 
     } else {
-        for (auto& mon : g_pCompositor->m_vMonitors) {
-            result += getFormat("Monitor %s:\n", mon->szName.c_str());
+        for (auto& mon : snapshot.layers) {
+            result += getFormat("Monitor %s:\n", mon.monitor.c_str());
             int                                     layerLevel = 0;
             static const std::array<std::string, 4> levelNames = {"background", "bottom", "top", "overlay"};
-            for (auto& level : mon->m_aLayerSurfaceLayers) {
+            for (auto& level : mon.levels) {
                 result += getFormat("\tLayer level %i (%s):\n", layerLevel, levelNames[layerLevel].c_str());
 
                 for (auto& layer : level) {
-                    result += getFormat("\t\tLayer %x: xywh: %i %i %i %i, namespace: %s\n", layer.get(), layer->geometry.x, layer->geometry.y, layer->geometry.width,
-                                        layer->geometry.height, layer->szNamespace.c_str());
+                    result += getFormat("\t\tLayer %x: xywh: %i %i %i %i, namespace: %s\n", layer.address, layer.x, layer.y, layer.w, layer.h, layer.ns.c_str());
                 }
 
                 layerLevel++;
@@ -317,166 +261,127 @@ std::string layersRequest(HyprCtl::eHyprCtlOutputFormat format) {
     return result;
 }
 
-std::string devicesRequest(HyprCtl::eHyprCtlOutputFormat format) {
+std::string devicesRequest(const SHyprCtlSnapshot& snapshot, HyprCtl::eHyprCtlOutputFormat format) {
     std::string result = "";
 
     if (format == HyprCtl::FORMAT_JSON) {
-        result += "{\n";
-        result += "\"mice\": [\n";
-
-        for (auto& m : g_pInputManager->m_lMice) {
-            result += getFormat(
-                R"#(    {
-        "address": "0x%x",
-        "name": "%s",
-        "defaultSpeed": %f
-    },)#",
-                &m, escapeJSONStrings(m.name).c_str(),
-                wlr_input_device_is_libinput(m.mouse) ? libinput_device_config_accel_get_default_speed((libinput_device*)wlr_libinput_get_device_handle(m.mouse)) : 0.f);
+        CJSONWriter json(result);
+        json.beginObject();
+
+        json.key("mice").beginArray();
+        for (auto& m : snapshot.mice) {
+            json.beginObject();
+            json.key("address").address(m.address);
+            json.key("name").string(m.name);
+            json.key("defaultSpeed").number(m.defaultSpeed);
+            json.endObject();
         }
-
-        // remove trailing comma
-        result.pop_back();
-        result += "\n],\n";
-
-        result += "\"keyboards\": [\n";
-        for (auto& k : g_pInputManager->m_lKeyboards) {
-            const auto KM = g_pInputManager->getActiveLayoutForKeyboard(&k);
-            result += getFormat(
-                R"#(    {
-        "address": "0x%x",
-        "name": "%s",
-        "rules": "%s",
-        "model": "%s",
-        "layout": "%s",
-        "variant": "%s",
-        "options": "%s",
-        "active_keymap": "%s",
-        "main": %s
-    },)#",
-                &k, escapeJSONStrings(k.name).c_str(), escapeJSONStrings(k.currentRules.rules).c_str(), escapeJSONStrings(k.currentRules.model).c_str(),
-                escapeJSONStrings(k.currentRules.layout).c_str(), escapeJSONStrings(k.currentRules.variant).c_str(), escapeJSONStrings(k.currentRules.options).c_str(),
-                escapeJSONStrings(KM).c_str(), (k.active ? "true" : "false"));
-        }
-
-        // remove trailing comma
-        result.pop_back();
-        result += "\n],\n";
-
-        result += "\"tablets\": [\n";
-
-        for (auto& d : g_pInputManager->m_lTabletPads) {
-            result += getFormat(
-                R"#(    {
-        "address": "0x%x",
-        "type": "tabletPad",
-        "belongsTo": {
-            "address": "0x%x",
-            "name": "%s"
+        json.endArray();
+
+        json.key("keyboards").beginArray();
+        for (auto& k : snapshot.keyboards) {
+            json.beginObject();
+            json.key("address").address(k.address);
+            json.key("name").string(k.name);
+            json.key("rules").string(k.rules);
+            json.key("model").string(k.model);
+            json.key("layout").string(k.layout);
+            json.key("variant").string(k.variant);
+            json.key("options").string(k.options);
+            json.key("active_keymap").string(k.activeKeymap);
+            json.key("main").boolean(k.main);
+            json.endObject();
         }
-    },)#",
-                &d, d.pTabletParent, escapeJSONStrings(d.pTabletParent ? d.pTabletParent->name : "").c_str());
+        json.endArray();
+
+        json.key("tablets").beginArray();
+        for (auto& d : snapshot.tabletPads) {
+            json.beginObject();
+            json.key("address").address(d.address);
+            json.key("type").string("tabletPad");
+            json.key("belongsTo").beginObject();
+            json.key("address").address(d.parent);
+            json.key("name").string(d.parentName);
+            json.endObject();
+            json.endObject();
         }
 
-        for (auto& d : g_pInputManager->m_lTablets) {
-            result += getFormat(
-                R"#(    {
-        "address": "0x%x",
-        "name": "%s"
-    },)#",
-                &d, escapeJSONStrings(d.name).c_str());
+        for (auto& d : snapshot.tablets) {
+            json.beginObject();
+            json.key("address").address(d.address);
+            json.key("name").string(d.name);
+            json.endObject();
         }
 
-        for (auto& d : g_pInputManager->m_lTabletTools) {
-            result += getFormat(
-                R"#(    {
-        "address": "0x%x",
-        "type": "tabletTool",
-        "belongsTo": "0x%x"
-    },)#",
-                &d, d.wlrTabletTool ? d.wlrTabletTool->data : 0);
+        for (auto& d : snapshot.tabletTools) {
+            json.beginObject();
+            json.key("address").address(d.address);
+            json.key("type").string("tabletTool");
+            json.key("belongsTo").address(d.parent);
+            json.endObject();
         }
-
-        // remove trailing comma
-        result.pop_back();
-        result += "\n],\n";
-
-        result += "\"touch\": [\n";
-
-        for (auto& d : g_pInputManager->m_lTouchDevices) {
-            result += getFormat(
-                R"#(    {
-        "address": "0x%x",
-        "name": "%s"
-    },)#",
-                &d, d.name.c_str());
+        json.endArray();
+
+        json.key("touch").beginArray();
+        for (auto& d : snapshot.touch) {
+            json.beginObject();
+            json.key("address").address(d.address);
+            json.key("name").string(d.name);
+            json.endObject();
         }
-
-        // remove trailing comma
-        if (result[result.size() - 1] == ',')
-            result.pop_back();
-        result += "\n],\n";
-
-        result += "\"switches\": [\n";
-
-        for (auto& d : g_pInputManager->m_lSwitches) {
-            result += getFormat(
-                R"#(    {
-        "address": "0x%x",
-        "name": "%s"
-    },)#",
-                &d, d.pWlrDevice ? d.pWlrDevice->name : "");
+        json.endArray();
+
+        json.key("switches").beginArray();
+        for (auto& d : snapshot.switches) {
+            json.beginObject();
+            json.key("address").address(d.address);
+            json.key("name").string(d.name);
+            json.endObject();
         }
+        json.endArray();
 
-        // remove trailing comma
-        if (result[result.size() - 1] == ',')
-            result.pop_back();
-        result += "\n]\n";
-
-        result += "}\n";
+        json.endObject();
+        result += "\n";
 
     } else {
         result += "mice:\n";
 
-        for (auto& m : g_pInputManager->m_lMice) {
-            result += getFormat(
-                "\tMouse at %x:\n\t\t%s\n\t\t\tdefault speed: %f\n", &m, m.name.c_str(),
-                (wlr_input_device_is_libinput(m.mouse) ? libinput_device_config_accel_get_default_speed((libinput_device*)wlr_libinput_get_device_handle(m.mouse)) : 0.f));
+        for (auto& m : snapshot.mice) {
+            result += getFormat("\tMouse at %x:\n\t\t%s\n\t\t\tdefault speed: %f\n", m.address, m.name.c_str(), m.defaultSpeed);
         }
 
         result += "\n\nKeyboards:\n";
 
-        for (auto& k : g_pInputManager->m_lKeyboards) {
-            const auto KM = g_pInputManager->getActiveLayoutForKeyboard(&k);
-            result += getFormat("\tKeyboard at %x:\n\t\t%s\n\t\t\trules: r \"%s\", m \"%s\", l \"%s\", v \"%s\", o \"%s\"\n\t\t\tactive keymap: %s\n\t\t\tmain: %s\n", &k,
-                                k.name.c_str(), k.currentRules.rules.c_str(), k.currentRules.model.c_str(), k.currentRules.layout.c_str(), k.currentRules.variant.c_str(),
-                                k.currentRules.options.c_str(), KM.c_str(), (k.active ? "yes" : "no"));
+        for (auto& k : snapshot.keyboards) {
+            result += getFormat("\tKeyboard at %x:\n\t\t%s\n\t\t\trules: r \"%s\", m \"%s\", l \"%s\", v \"%s\", o \"%s\"\n\t\t\tactive keymap: %s\n\t\t\tmain: %s\n", k.address,
+                                k.name.c_str(), k.rules.c_str(), k.model.c_str(), k.layout.c_str(), k.variant.c_str(), k.options.c_str(), k.activeKeymap.c_str(),
+                                (k.main ? "yes" : "no"));
         }
 
         result += "\n\nTablets:\n";
 
-        for (auto& d : g_pInputManager->m_lTabletPads) {
-            result += getFormat("\tTablet Pad at %x (belongs to %x -> %s)\n", &d, d.pTabletParent, d.pTabletParent ? d.pTabletParent->name.c_str() : "");
+        for (auto& d : snapshot.tabletPads) {
+            result += getFormat("\tTablet Pad at %x (belongs to %x -> %s)\n", d.address, d.parent, d.parentName.c_str());
         }
 
-        for (auto& d : g_pInputManager->m_lTablets) {
-            result += getFormat("\tTablet at %x:\n\t\t%s\n", &d, d.name.c_str());
+        for (auto& d : snapshot.tablets) {
+            result += getFormat("\tTablet at %x:\n\t\t%s\n", d.address, d.name.c_str());
         }
 
-        for (auto& d : g_pInputManager->m_lTabletTools) {
-            result += getFormat("\tTablet Tool at %x (belongs to %x)\n", &d, d.wlrTabletTool ? d.wlrTabletTool->data : 0);
+        for (auto& d : snapshot.tabletTools) {
+            result += getFormat("\tTablet Tool at %x (belongs to %x)\n", d.address, d.parent);
         }
 
         result += "\n\nTouch:\n";
 
-        for (auto& d : g_pInputManager->m_lTouchDevices) {
-            result += getFormat("\tTouch Device at %x:\n\t\t%s\n", &d, d.name.c_str());
+        for (auto& d : snapshot.touch) {
+            result += getFormat("\tTouch Device at %x:\n\t\t%s\n", d.address, d.name.c_str());
         }
 
         result += "\n\nSwitches:\n";
 
-        for (auto& d : g_pInputManager->m_lSwitches) {
-            result += getFormat("\tSwitch Device at %x:\n\t\t%s\n", &d, d.pWlrDevice ? d.pWlrDevice->name : "");
+        for (auto& d : snapshot.switches) {
+            result += getFormat("\tSwitch Device at %x:\n\t\t%s\n", d.address, d.name.c_str());
         }
     }
 
@@ -604,6 +509,146 @@ std::string bindsRequest(HyprCtl::eHyprCtlOutputFormat format) {
     return ret;
 }
 
+std::string ruleCacheRequest(HyprCtl::eHyprCtlOutputFormat format) {
+    if (format == HyprCtl::eHyprCtlOutputFormat::FORMAT_NORMAL)
+        return getFormat("window rule cache:\n\tentries: %lu (max %i)\n\thits: %llu\n\tmisses: %llu\n", g_pConfigManager->getRuleCacheSize(), WINDOWRULE_CACHE_MAX_ENTRIES,
+                         g_pConfigManager->m_iRuleCacheHits, g_pConfigManager->m_iRuleCacheMisses);
+
+    return getFormat(
+        R"#({
+    "entries": %lu,
+    "maxEntries": %i,
+    "hits": %llu,
+    "misses": %llu
+})#",
+        g_pConfigManager->getRuleCacheSize(), WINDOWRULE_CACHE_MAX_ENTRIES, g_pConfigManager->m_iRuleCacheHits, g_pConfigManager->m_iRuleCacheMisses);
+}
+
+std::string gpuTimesRequest(HyprCtl::eHyprCtlOutputFormat format) {
+    if (!g_pHyprOpenGL->m_GPUTimers.supported())
+        return "GPU timers are not supported by this driver";
+
+    if (!g_pConfigManager->getInt(CFG_DEBUG_GPU_TIMERS))
+        return "GPU timers are off, set debug:gpu_timers to 1";
+
+    std::string result = "";
+
+    if (format == HyprCtl::FORMAT_JSON) {
+        CJSONWriter json(result);
+        json.beginArray();
+
+        for (auto& m : g_pCompositor->m_vMonitors) {
+            const auto IT = g_pHyprOpenGL->m_GPUTimers.m_mTimes.find(m.get());
+            if (IT == g_pHyprOpenGL->m_GPUTimers.m_mTimes.end())
+                continue;
+
+            json.beginObject();
+            json.key("monitor").string(m->szName);
+            json.key("frames").integer(IT->second.frames);
+            json.key("dropped").integer(IT->second.dropped);
+            json.key("passes").beginObject();
+
+            for (size_t i = 0; i < GPU_PASS_COUNT; ++i) {
+                json.key(GPU_PASS_NAMES[i]).beginObject();
+                json.key("last").number(IT->second.last[i], 3);
+                json.key("average").number(IT->second.smoothed[i], 3);
+                json.endObject();
+            }
+
+            json.endObject();
+            json.endObject();
+        }
+
+        json.endArray();
+    } else {
+        for (auto& m : g_pCompositor->m_vMonitors) {
+            const auto IT = g_pHyprOpenGL->m_GPUTimers.m_mTimes.find(m.get());
+            if (IT == g_pHyprOpenGL->m_GPUTimers.m_mTimes.end())
+                continue;
+
+            result += getFormat("Monitor %s (%lu frames, %lu dropped):\n", m->szName.c_str(), IT->second.frames, IT->second.dropped);
+
+            for (size_t i = 0; i < GPU_PASS_COUNT; ++i)
+                result += getFormat("\t%s: %.3fms (last %.3fms)\n", GPU_PASS_NAMES[i], IT->second.smoothed[i], IT->second.last[i]);
+
+            result += "\n";
+        }
+    }
+
+    return result;
+}
+
+std::string frameTimesRequest(std::string request, HyprCtl::eHyprCtlOutputFormat format) {
+    if (CVarList(request, 0, ' ')[1] == "reset") {
+        for (auto& m : g_pCompositor->m_vMonitors)
+            m->frameStats.reset();
+
+        return "ok";
+    }
+
+    const std::pair<const char*, CHistogram SFrameStats::*> HISTOGRAMS[] = {
+        {"renderTime", &SFrameStats::renderTime},
+        {"frameInterval", &SFrameStats::frameInterval},
+        {"presentationLatency", &SFrameStats::presentationLatency},
+        {"damage", &SFrameStats::damage},
+        {"inputLatency", &SFrameStats::inputLatency},
+    };
+
+    std::string result = "";
+
+    if (format == HyprCtl::FORMAT_JSON) {
+        CJSONWriter json(result);
+        json.beginArray();
+
+        for (auto& m : g_pCompositor->m_vMonitors) {
+            const auto& STATS = m->frameStats;
+
+            json.beginObject();
+            json.key("monitor").string(m->szName);
+            json.key("frames").integer(STATS.frames);
+            json.key("presented").integer(STATS.presented);
+            json.key("discarded").integer(STATS.discarded);
+            json.key("missedVblanks").integer(STATS.missedVblanks);
+
+            for (auto& [name, histogram] : HISTOGRAMS) {
+                const auto& H = STATS.*histogram;
+
+                json.key(name).beginObject();
+                json.key("count").integer(H.count());
+                json.key("avg").number(H.average(), 3);
+                json.key("p50").number(H.percentile(0.5f), 3);
+                json.key("p95").number(H.percentile(0.95f), 3);
+                json.key("p99").number(H.percentile(0.99f), 3);
+                json.key("max").number(H.max(), 3);
+                json.endObject();
+            }
+
+            json.endObject();
+        }
+
+        json.endArray();
+    } else {
+        for (auto& m : g_pCompositor->m_vMonitors) {
+            const auto& STATS = m->frameStats;
+
+            result += getFormat("Monitor %s: %lu frames, %lu presented, %lu discarded, %lu missed vblanks\n", m->szName.c_str(), STATS.frames, STATS.presented, STATS.discarded,
+                                STATS.missedVblanks);
+
+            for (auto& [name, histogram] : HISTOGRAMS) {
+                const auto& H    = STATS.*histogram;
+                const auto  UNIT = histogram == &SFrameStats::damage ? "%" : "ms";
+
+                result += getFormat("\t%s: avg %.2f%s p50 %.2f%s p95 %.2f%s p99 %.2f%s max %.2f%s\n", name, H.average(), UNIT, H.percentile(0.5f), UNIT, H.percentile(0.95f), UNIT,
+                                    H.percentile(0.99f), UNIT, H.max(), UNIT);
+            }
+
+            result += "\n";
+        }
+    }
+
+    return result;
+}
+
 std::string versionRequest(HyprCtl::eHyprCtlOutputFormat format) {
 
     if (format == HyprCtl::eHyprCtlOutputFormat::FORMAT_NORMAL) {
@@ -691,14 +736,18 @@ std::string dispatchKeyword(std::string in) {
         g_pConfigManager->m_bWantsMonitorReload = true; // for monitor keywords
 
     if (COMMAND.contains("input") || COMMAND.contains("device:")) {
-        g_pInputManager->setKeyboardLayout();     // update kb layout
-        g_pInputManager->setPointerConfigs();     // update mouse cfgs
-        g_pInputManager->setTouchDeviceConfigs(); // update touch device cfgs
-        g_pInputManager->setTabletConfigs();      // update tablets
+        if (g_pCompositor->m_sTransaction.depth > 0)
+            g_pCompositor->m_sTransaction.updateInputConfigs = true; // applied when the batch commits
+        else {
+            g_pInputManager->setKeyboardLayout();     // update kb layout
+            g_pInputManager->setPointerConfigs();     // update mouse cfgs
+            g_pInputManager->setTouchDeviceConfigs(); // update touch device cfgs
+            g_pInputManager->setTabletConfigs();      // update tablets
+        }
     }
 
     if (COMMAND.contains("general:layout"))
-        g_pLayoutManager->switchToLayout(g_pConfigManager->getString("general:layout")); // update layout
+        g_pLayoutManager->switchToLayout(g_pConfigManager->getString(CFG_GENERAL_LAYOUT)); // update layout
 
     if (COMMAND.contains("decoration:screen_shader"))
         g_pHyprOpenGL->m_bReloadScreenShader = true;
@@ -793,12 +842,22 @@ std::string dispatchBatch(std::string request) {
 
     nextItem();
 
-    while (curitem != "") {
-        reply += getReply(curitem);
+    // layout, monitor, decoration and damage updates are applied once at the end instead of per command
+    g_pCompositor->beginTransaction();
+
+    try {
+        while (curitem != "") {
+            reply += getReply(curitem);
 
-        nextItem();
+            nextItem();
+        }
+    } catch (...) {
+        g_pCompositor->commitTransaction();
+        throw;
     }
 
+    g_pCompositor->commitTransaction();
+
     return reply;
 }
 
@@ -1165,6 +1224,188 @@ std::string dispatchPlugin(std::string request) {
     return "ok";
 }
 
+std::string dispatchConfigBench(std::string request) {
+    CVarList vars(request, 3, ' ');
+
+    int      iterations = 100;
+
+    if (!vars[1].empty()) {
+        if (!isNumber(vars[1]))
+            return "invalid arg 1";
+
+        try {
+            iterations = std::stoi(vars[1]);
+        } catch (std::exception& e) { return "invalid arg 1"; }
+    }
+
+    return g_pConfigManager->benchmarkConfigCache(iterations, vars[2]);
+}
+
+// the old getFormat() + concatenation way of building a clients reply, kept for jsonbench to compare against
+static std::string legacyClientsJSON(int windows, const std::string& title, const std::string& windowClass) {
+    std::string result = "[";
+
+    for (int i = 0; i < windows; ++i) {
+        result += getFormat(
+            R"#({
+    "address": "0x%x",
+    "mapped": %s,
+    "hidden": %s,
+    "at": [%i, %i],
+    "size": [%i, %i],
+    "workspace": {
+        "id": %i,
+        "name": "%s"
+    },
+    "floating": %s,
+    "monitor": %i,
+    "class": "%s",
+    "title": "%s",
+    "initialClass": "%s",
+    "initialTitle": "%s",
+    "pid": %i,
+    "xwayland": %s,
+    "pinned": %s,
+    "fullscreen": %s,
+    "fullscreenMode": %i,
+    "fakeFullscreen": %s,
+    "grouped": [%s],
+    "swallowing": %s
+},)#",
+            0x1000 + i, "true", "false", i, i, 800, 600, i % 10 + 1, escapeJSONStrings(std::to_string(i % 10 + 1)).c_str(), "false", 0, escapeJSONStrings(windowClass).c_str(),
+            escapeJSONStrings(title).c_str(), escapeJSONStrings(windowClass).c_str(), escapeJSONStrings(title).c_str(), 1000 + i, "false", "false", "false", 0, "false", "",
+            "null");
+    }
+
+    result.pop_back();
+    result += "]";
+
+    return result;
+}
+
+static std::string writerClientsJSON(int windows, const std::string& title, const std::string& windowClass) {
+    std::string result = "";
+    result.reserve(windows * 1024);
+
+    CJSONWriter json(result);
+    json.beginArray();
+
+    for (int i = 0; i < windows; ++i) {
+        json.beginObject();
+        json.key("address").address((void*)(uintptr_t)(0x1000 + i));
+        json.key("mapped").boolean(true);
+        json.key("hidden").boolean(false);
+        json.key("at").beginArray(true).integer(i).integer(i).endArray();
+        json.key("size").beginArray(true).integer(800).integer(600).endArray();
+        json.key("workspace").beginObject();
+        json.key("id").integer(i % 10 + 1);
+        json.key("name").string(std::to_string(i % 10 + 1));
+        json.endObject();
+        json.key("floating").boolean(false);
+        json.key("monitor").integer(0);
+        json.key("class").string(windowClass);
+        json.key("title").string(title);
+        json.key("initialClass").string(windowClass);
+        json.key("initialTitle").string(title);
+        json.key("pid").integer(1000 + i);
+        json.key("xwayland").boolean(false);
+        json.key("pinned").boolean(false);
+        json.key("fullscreen").boolean(false);
+        json.key("fullscreenMode").integer(0);
+        json.key("fakeFullscreen").boolean(false);
+        json.key("grouped").beginArray(true).endArray();
+        json.key("swallowing").null();
+        json.endObject();
+    }
+
+    json.endArray();
+
+    return result;
+}
+
+std::string dispatchTrace(std::string request) {
+    CVarList vars(request, 3, ' ');
+
+    if (vars[1] == "start") {
+        Tracing::start();
+        return "ok";
+    } else if (vars[1] == "stop") {
+        Tracing::stop();
+        return getFormat("ok, %lu events recorded", Tracing::eventCount());
+    } else if (vars[1] == "dump") {
+        const auto TRACE = Tracing::dump();
+
+        if (vars[2].empty())
+            return TRACE;
+
+        // resolved by Hyprland, not hyprctl, so relative paths are relative to the compositor's cwd
+        std::ofstream ofs(vars[2], std::ios::trunc);
+        if (!ofs.good())
+            return "couldn't open " + vars[2];
+
+        ofs << TRACE;
+
+        return "ok, trace written to " + vars[2];
+    } else if (!vars[1].empty())
+        return "unknown trace command, expected start, stop or dump";
+
+    return getFormat("tracing %s, %lu events recorded", Tracing::enabled ? "on" : "off", Tracing::eventCount());
+}
+
+std::string dispatchJSONBench(std::string request) {
+    CVarList vars(request, 3, ' ');
+
+    int      iterations = 100;
+    int      windows    = 200;
+
+    try {
+        if (!vars[1].empty())
+            iterations = std::stoi(vars[1]);
+        if (!vars[2].empty())
+            windows = std::stoi(vars[2]);
+    } catch (std::exception& e) { return "invalid args"; }
+
+    if (iterations < 1 || windows < 1)
+        return "invalid args";
+
+    const std::string TITLE = "~/projects/hyprland - nvim \"src/debug/HyprCtl.cpp\"\t[+]";
+    const std::string CLASS = "org.wezfurlong.wezterm";
+
+    size_t            bytes = 0;
+
+    auto              timeUs = [&](const std::function<std::string()>& fn) {
+        const auto BEGIN = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            bytes = fn().length();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - BEGIN).count() / 1000.f / iterations;
+    };
+
+    const float LEGACYUS   = timeUs([&]() { return legacyClientsJSON(windows, TITLE, CLASS); });
+    const float WRITERUS   = timeUs([&]() { return writerClientsJSON(windows, TITLE, CLASS); });
+    const auto  SYNTHBYTES = bytes;
+    const float LIVEUS     = timeUs([&]() { return clientsRequest(*HyprCtl::getSnapshot(), HyprCtl::FORMAT_JSON); });
+
+    return getFormat("iterations: %i\n\tsynthetic clients (%i windows, %lu bytes):\n\t\tgetFormat: %.1fus\n\t\tCJSONWriter: %.1fus\n\t\tspeedup: %.2fx\n\tlive clients (%lu "
+                     "windows, %lu bytes): %.1fus\n",
+                     iterations, windows, SYNTHBYTES, LEGACYUS, WRITERUS, WRITERUS > 0 ? LEGACYUS / WRITERUS : 0.f, g_pCompositor->m_vWindows.size(), bytes, LIVEUS);
+}
+
+std::string dispatchLayoutBench(std::string request) {
+    CVarList vars(request, 3, ' ');
+
+    int      iterations = 50;
+    int      windows    = 200;
+
+    try {
+        if (!vars[1].empty())
+            iterations = std::stoi(vars[1]);
+        if (!vars[2].empty())
+            windows = std::stoi(vars[2]);
+    } catch (std::exception& e) { return "invalid args"; }
+
+    return g_pLayoutManager->benchmarkLayouts(iterations, windows);
+}
+
 std::string dispatchNotify(std::string request) {
     CVarList vars(request, 0, ' ');
 
@@ -1206,10 +1447,10 @@ std::string dispatchNotify(std::string request) {
     return "ok";
 }
 
-std::string getReply(std::string request) {
+// removes the flags and separator of non-batch requests, returning the output format they asked for
+static HyprCtl::eHyprCtlOutputFormat stripRequestFlags(std::string& request) {
     auto format = HyprCtl::FORMAT_NORMAL;
 
-    // process flags for non-batch requests
     if (!request.contains("[[BATCH]]") && request.contains("/")) {
         long unsigned int sepIndex = 0;
         for (const auto& c : request) {
@@ -1227,24 +1468,42 @@ std::string getReply(std::string request) {
             request = request.substr(sepIndex + 1); // remove flags and separator so we can compare the rest of the string
     }
 
+    return format;
+}
+
+static bool isReadOnlyRequest(const std::string& request) {
+    return request == "monitors" || request == "workspaces" || request == "clients" || request == "activewindow" || request == "layers" || request == "devices";
+}
+
+// the queries answered from a snapshot, safe to call from any thread
+static std::string readOnlyReply(const SHyprCtlSnapshot& snapshot, const std::string& request, HyprCtl::eHyprCtlOutputFormat format) {
     if (request == "monitors")
-        return monitorsRequest(format);
+        return monitorsRequest(snapshot, format);
     else if (request == "workspaces")
-        return workspacesRequest(format);
+        return workspacesRequest(snapshot, format);
     else if (request == "clients")
-        return clientsRequest(format);
-    else if (request == "kill")
-        return killRequest();
+        return clientsRequest(snapshot, format);
     else if (request == "activewindow")
-        return activeWindowRequest(format);
+        return activeWindowRequest(snapshot, format);
     else if (request == "layers")
-        return layersRequest(format);
+        return layersRequest(snapshot, format);
+    else if (request == "devices")
+        return devicesRequest(snapshot, format);
+
+    return "unknown request";
+}
+
+std::string getReply(std::string request) {
+    auto format = stripRequestFlags(request);
+
+    if (isReadOnlyRequest(request))
+        return readOnlyReply(*HyprCtl::getSnapshot(), request, format);
+    else if (request == "kill")
+        return killRequest();
     else if (request == "version")
         return versionRequest(format);
     else if (request.find("reload") == 0)
         return reloadRequest(request);
-    else if (request == "devices")
-        return devicesRequest(format);
     else if (request == "splash")
         return splashRequest();
     else if (request == "cursorpos")
@@ -1255,10 +1514,24 @@ std::string getReply(std::string request) {
         return globalShortcutsRequest(format);
     else if (request == "animations")
         return animationsRequest(format);
+    else if (request == "rulecache")
+        return ruleCacheRequest(format);
+    else if (request == "gputimes")
+        return gpuTimesRequest(format);
+    else if (request.find("frametimes") == 0)
+        return frameTimesRequest(request, format);
     else if (request.find("plugin") == 0)
         return dispatchPlugin(request);
     else if (request.find("notify") == 0)
         return dispatchNotify(request);
+    else if (request.find("configbench") == 0)
+        return dispatchConfigBench(request);
+    else if (request.find("jsonbench") == 0)
+        return dispatchJSONBench(request);
+    else if (request.find("layoutbench") == 0)
+        return dispatchLayoutBench(request);
+    else if (request.find("trace") == 0)
+        return dispatchTrace(request);
     else if (request.find("setprop") == 0)
         return dispatchSetProp(request);
     else if (request.find("seterror") == 0)
@@ -1285,21 +1558,60 @@ std::string HyprCtl::makeDynamicCall(const std::string& input) {
     return getReply(input);
 }
 
-int hyprCtlFDTick(int fd, uint32_t mask, void* data) {
-    if (mask & WL_EVENT_ERROR || mask & WL_EVENT_HANGUP)
-        return 0;
-
-    sockaddr_in clientAddress;
-    socklen_t   clientSize = sizeof(clientAddress);
-
-    const auto  ACCEPTEDCONNECTION = accept(HyprCtl::iSocketFD, (sockaddr*)&clientAddress, &clientSize);
-
-    char        readBuffer[1024];
-
-    auto        messageSize                              = read(ACCEPTEDCONNECTION, readBuffer, 1024);
-    readBuffer[messageSize == 1024 ? 1023 : messageSize] = '\0';
+struct SHyprCtlPendingReply {
+    uint64_t    slot    = 0;
+    uint32_t    frameID = 0;
+    bool        ready   = false;
+    std::string reply   = "";
+};
+
+struct SHyprCtlClient {
+    uint64_t                         id     = 0;
+    int                              fd     = -1;
+    wl_event_source*                 source = nullptr;
+
+    bool                             handshakeDone = false;
+    bool                             framed        = false;
+    bool                             closing       = false; // close once all replies are written
+
+    std::string                      readBuffer  = "";
+    std::string                      writeBuffer = "";
+    size_t                           writeOffset = 0;
+
+    // replies in request order, the ones answered by the worker become ready out of order
+    std::deque<SHyprCtlPendingReply> pendingReplies;
+    uint64_t                         nextSlot = 0;
+};
+
+// a read-only request on its way through the worker thread
+struct SHyprCtlJob {
+    uint64_t                                client = 0;
+    uint64_t                                slot   = 0;
+    std::string                             request;
+    HyprCtl::eHyprCtlOutputFormat           format = HyprCtl::FORMAT_NORMAL;
+    std::shared_ptr<const SHyprCtlSnapshot> snapshot;
+    std::string                             reply;
+};
+
+static std::list<SHyprCtlClient> hyprCtlClients;
+static uint64_t                  nextHyprCtlClientID = 1;
+
+static std::mutex                hyprCtlJobMutex;
+static std::condition_variable   hyprCtlJobCV;
+static std::deque<SHyprCtlJob>   hyprCtlJobs;
+static std::mutex                hyprCtlDoneMutex;
+static std::deque<SHyprCtlJob>   hyprCtlDoneJobs;
+static int                       hyprCtlDoneFD = -1;
+
+static void                      closeHyprCtlClient(SHyprCtlClient* client) {
+    wl_event_source_remove(client->source);
+    close(client->fd);
+
+    hyprCtlClients.remove_if([&](const auto& other) { return &other == client; });
+}
 
-    std::string request(readBuffer);
+static std::string handleHyprCtlRequest(const std::string& request) {
+    TRACE_SCOPE("ipc", "hyprctl");
 
     std::string reply = "";
 
@@ -1310,14 +1622,272 @@ int hyprCtlFDTick(int fd, uint32_t mask, void* data) {
         reply = "Err: " + std::string(e.what());
     }
 
-    write(ACCEPTEDCONNECTION, reply.c_str(), reply.length());
-
-    close(ACCEPTEDCONNECTION);
-
     if (g_pConfigManager->m_bWantsMonitorReload) {
         g_pConfigManager->ensureMonitorStatus();
     }
 
+    // whatever it was, it might have changed something
+    HyprCtl::markStateChanged();
+
+    return reply;
+}
+
+// read-only requests go to the worker with the current snapshot, the rest are handled right away
+static void queueHyprCtlRequest(SHyprCtlClient* client, uint32_t frameID, const std::string& request) {
+    auto& pending   = client->pendingReplies.emplace_back();
+    pending.slot    = client->nextSlot++;
+    pending.frameID = frameID;
+
+    std::string stripped = request;
+    const auto  FORMAT   = stripRequestFlags(stripped);
+
+    if (hyprCtlDoneFD >= 0 && isReadOnlyRequest(stripped)) {
+        std::lock_guard<std::mutex> lg(hyprCtlJobMutex);
+        hyprCtlJobs.emplace_back(SHyprCtlJob{client->id, pending.slot, stripped, FORMAT, HyprCtl::getSnapshot()});
+        hyprCtlJobCV.notify_one();
+        return;
+    }
+
+    pending.reply = handleHyprCtlRequest(request);
+    pending.ready = true;
+}
+
+// moves the replies that are ready, in order, into the write buffer
+static void collectHyprCtlReplies(SHyprCtlClient* client) {
+    while (!client->pendingReplies.empty() && client->pendingReplies.front().ready) {
+        auto& pending = client->pendingReplies.front();
+
+        if (client->framed) {
+            const uint32_t REPLYLENGTH = pending.reply.length();
+
+            client->writeBuffer.append((const char*)&pending.frameID, sizeof(uint32_t));
+            client->writeBuffer.append((const char*)&REPLYLENGTH, sizeof(uint32_t));
+        }
+
+        client->writeBuffer += pending.reply;
+
+        client->pendingReplies.pop_front();
+    }
+}
+
+// parses every complete frame in the read buffer and queues the requests, returns false on a protocol error
+static bool processHyprCtlFrames(SHyprCtlClient* client) {
+    size_t offset = 0;
+
+    while (client->readBuffer.size() - offset >= HyprCtl::FRAME_HEADER_SIZE) {
+        uint32_t id     = 0;
+        uint32_t length = 0;
+        memcpy(&id, client->readBuffer.data() + offset, sizeof(uint32_t));
+        memcpy(&length, client->readBuffer.data() + offset + sizeof(uint32_t), sizeof(uint32_t));
+
+        if (length > HyprCtl::MAX_FRAME_SIZE) {
+            Debug::log(ERR, "hyprctl: client sent a frame of %u bytes, dropping the connection", length);
+            return false;
+        }
+
+        if (client->readBuffer.size() - offset - HyprCtl::FRAME_HEADER_SIZE < length)
+            break;
+
+        queueHyprCtlRequest(client, id, client->readBuffer.substr(offset + HyprCtl::FRAME_HEADER_SIZE, length));
+
+        offset += HyprCtl::FRAME_HEADER_SIZE + length;
+    }
+
+    client->readBuffer.erase(0, offset);
+
+    return true;
+}
+
+// writes as much as the socket takes, returns false if the client is gone
+static bool flushHyprCtlClient(SHyprCtlClient* client) {
+    while (client->writeOffset < client->writeBuffer.length()) {
+        const auto WRITTEN = write(client->fd, client->writeBuffer.data() + client->writeOffset, client->writeBuffer.length() - client->writeOffset);
+
+        if (WRITTEN < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            if (errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        client->writeOffset += WRITTEN;
+    }
+
+    if (client->writeOffset == client->writeBuffer.length()) {
+        client->writeBuffer.clear();
+        client->writeOffset = 0;
+    }
+
+    return true;
+}
+
+// writes what's ready and decides what to wait for next, may close the client
+static void updateHyprCtlClient(SHyprCtlClient* client) {
+    collectHyprCtlReplies(client);
+
+    if (!flushHyprCtlClient(client) || (client->closing && client->writeBuffer.empty() && client->pendingReplies.empty())) {
+        closeHyprCtlClient(client);
+        return;
+    }
+
+    uint32_t newMask = client->writeBuffer.empty() ? 0 : WL_EVENT_WRITABLE;
+    if (!client->closing && client->writeBuffer.length() < HyprCtl::MAX_FRAME_SIZE)
+        newMask |= WL_EVENT_READABLE;
+
+    wl_event_source_fd_update(client->source, newMask);
+}
+
+// reads what the client sent and queues the requests in it, returns false on a protocol error
+static bool readHyprCtlClient(SHyprCtlClient* client) {
+    char readBuffer[8192];
+
+    // don't buffer more requests while the client isn't reading its replies
+    while (client->writeBuffer.length() < HyprCtl::MAX_FRAME_SIZE) {
+        const auto READ = read(client->fd, readBuffer, sizeof(readBuffer));
+
+        if (READ < 0 && errno == EINTR)
+            continue;
+
+        if (READ == 0)
+            client->closing = true;
+
+        if (READ <= 0)
+            break;
+
+        client->readBuffer.append(readBuffer, READ);
+    }
+
+    if (!client->handshakeDone && !client->readBuffer.empty()) {
+        if (client->readBuffer[0] != HyprCtl::FRAMED_MAGIC[0]) {
+            // one-shot: the whole request arrives at once, reply and close
+            client->handshakeDone = true;
+            client->closing       = true;
+            queueHyprCtlRequest(client, 0, client->readBuffer);
+            client->readBuffer.clear();
+        } else if (client->readBuffer.length() >= HyprCtl::FRAMED_MAGIC.length()) {
+            if (!client->readBuffer.starts_with(HyprCtl::FRAMED_MAGIC))
+                return false;
+
+            client->handshakeDone = true;
+            client->framed        = true;
+            client->readBuffer.erase(0, HyprCtl::FRAMED_MAGIC.length());
+        }
+    }
+
+    return !client->framed || processHyprCtlFrames(client);
+}
+
+static int hyprCtlClientTick(int fd, uint32_t mask, void* data) {
+    const auto CLIENT = (SHyprCtlClient*)data;
+
+    if (mask & WL_EVENT_ERROR) {
+        closeHyprCtlClient(CLIENT);
+        return 0;
+    }
+
+    if (mask & WL_EVENT_HANGUP) {
+        // a client that sends and closes right away still gets its requests handled,
+        // there is just nobody left to read the replies
+        if (!CLIENT->closing) {
+            CLIENT->writeBuffer.clear();
+            CLIENT->writeOffset = 0;
+            readHyprCtlClient(CLIENT);
+        }
+
+        closeHyprCtlClient(CLIENT);
+        return 0;
+    }
+
+    if (mask & WL_EVENT_READABLE && !CLIENT->closing && !readHyprCtlClient(CLIENT)) {
+        closeHyprCtlClient(CLIENT);
+        return 0;
+    }
+
+    updateHyprCtlClient(CLIENT);
+
+    return 0;
+}
+
+static int hyprCtlJobsDone(int fd, uint32_t mask, void* data) {
+    eventfd_t value;
+    eventfd_read(fd, &value);
+
+    std::deque<SHyprCtlJob> done;
+    {
+        std::lock_guard<std::mutex> lg(hyprCtlDoneMutex);
+        done.swap(hyprCtlDoneJobs);
+    }
+
+    for (auto& job : done) {
+        const auto CLIENT = std::find_if(hyprCtlClients.begin(), hyprCtlClients.end(), [&](const auto& other) { return other.id == job.client; });
+
+        if (CLIENT == hyprCtlClients.end())
+            continue; // disconnected while we were at it
+
+        for (auto& pending : CLIENT->pendingReplies) {
+            if (pending.slot != job.slot)
+                continue;
+
+            pending.reply = std::move(job.reply);
+            pending.ready = true;
+            break;
+        }
+
+        updateHyprCtlClient(&*CLIENT);
+    }
+
+    return 0;
+}
+
+static void hyprCtlWorker() {
+    Tracing::setThreadName("hyprctl worker");
+
+    while (true) {
+        SHyprCtlJob job;
+
+        {
+            std::unique_lock<std::mutex> lk(hyprCtlJobMutex);
+            hyprCtlJobCV.wait(lk, [] { return !hyprCtlJobs.empty(); });
+            job = std::move(hyprCtlJobs.front());
+            hyprCtlJobs.pop_front();
+        }
+
+        try {
+            TRACE_SCOPE("ipc", "hyprctlWorker");
+            job.reply = readOnlyReply(*job.snapshot, job.request, job.format);
+        } catch (std::exception& e) { job.reply = "Err: " + std::string(e.what()); }
+
+        // the main thread might have published a newer one already, don't keep this one alive longer than needed
+        job.snapshot.reset();
+
+        {
+            std::lock_guard<std::mutex> lg(hyprCtlDoneMutex);
+            hyprCtlDoneJobs.emplace_back(std::move(job));
+        }
+
+        eventfd_write(hyprCtlDoneFD, 1);
+    }
+}
+
+int hyprCtlFDTick(int fd, uint32_t mask, void* data) {
+    if (mask & WL_EVENT_ERROR || mask & WL_EVENT_HANGUP)
+        return 0;
+
+    sockaddr_in clientAddress;
+    socklen_t   clientSize = sizeof(clientAddress);
+
+    const auto  ACCEPTEDCONNECTION = accept4(HyprCtl::iSocketFD, (sockaddr*)&clientAddress, &clientSize, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+    if (ACCEPTEDCONNECTION < 0)
+        return 0;
+
+    const auto PCLIENT = &hyprCtlClients.emplace_back();
+    PCLIENT->id        = nextHyprCtlClientID++;
+    PCLIENT->fd        = ACCEPTEDCONNECTION;
+    PCLIENT->source    = wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, ACCEPTEDCONNECTION, WL_EVENT_READABLE, hyprCtlClientTick, PCLIENT);
+
     return 0;
 }
 
@@ -1347,4 +1917,16 @@ void HyprCtl::startHyprCtlSocket() {
     Debug::log(LOG, "Hypr socket started at %s", socketPath.c_str());
 
     wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, iSocketFD, WL_EVENT_READABLE, hyprCtlFDTick, nullptr);
+
+    // read-only queries are formatted off the main thread, if that's not possible everything runs here as before
+    hyprCtlDoneFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (hyprCtlDoneFD < 0) {
+        Debug::log(ERR, "Couldn't create the hyprctl worker eventfd, serving all requests on the main thread");
+        return;
+    }
+
+    wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, hyprCtlDoneFD, WL_EVENT_READABLE, hyprCtlJobsDone, nullptr);
+
+    std::thread(hyprCtlWorker).detach();
 }
@@ -19,6 +19,15 @@ namespace HyprCtl {
 
     inline int              iSocketFD = -1;
 
+    // .socket.sock speaks two protocols, told apart by the first byte.
+    // one-shot: write a request, read the reply until the socket closes.
+    // framed: write FRAMED_MAGIC once, then any number of [u32 id][u32 length][request] frames,
+    // each answered in order with a [u32 id][u32 length][reply] frame on the same connection.
+    // integers are in host byte order.
+    inline constexpr std::string_view FRAMED_MAGIC      = {"\0HYPRCTL", 8};
+    inline constexpr size_t           FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+    inline constexpr uint32_t         MAX_FRAME_SIZE    = 16 * 1024 * 1024;
+
     enum eHyprCtlOutputFormat {
         FORMAT_NORMAL = 0,
         FORMAT_JSON
@@ -0,0 +1,215 @@
+#include "HyprCtlSnapshot.hpp"
+#include "../Compositor.hpp"
+
+static std::shared_ptr<const SHyprCtlSnapshot> publishedSnapshot;
+static uint32_t                                dirtySections = 0;
+static wl_event_source*                        publishTimer  = nullptr;
+
+static SWindowSnapshot                         snapshotWindow(CWindow* w) {
+    SWindowSnapshot window;
+
+    const auto      PWORKSPACE = g_pCompositor->getWorkspaceByID(w->m_iWorkspaceID);
+
+    window.address        = w;
+    window.mapped         = w->m_bIsMapped;
+    window.hidden         = w->isHidden();
+    window.position       = w->m_vRealPosition.goalv();
+    window.size           = w->m_vRealSize.goalv();
+    window.workspaceID    = w->m_iWorkspaceID;
+    window.workspaceName  = w->m_iWorkspaceID == -1 ? "" : PWORKSPACE ? PWORKSPACE->m_szName : "Invalid workspace " + std::to_string(w->m_iWorkspaceID);
+    window.floating       = w->m_bIsFloating;
+    window.monitor        = w->m_iMonitorID;
+    window.windowClass    = g_pXWaylandManager->getAppIDClass(w);
+    window.title          = g_pXWaylandManager->getTitle(w);
+    window.initialClass   = w->m_szInitialClass;
+    window.initialTitle   = w->m_szInitialTitle;
+    window.pid            = w->getPID();
+    window.xwayland       = w->m_bIsX11;
+    window.pinned         = w->m_bPinned;
+    window.fullscreen     = w->m_bIsFullscreen;
+    window.fullscreenMode = w->m_bIsFullscreen && PWORKSPACE ? PWORKSPACE->m_efFullscreenMode : 0;
+    window.fakeFullscreen = w->m_bFakeFullscreenState;
+    window.swallowing     = w->m_pSwallowed;
+
+    if (w->m_sGroupData.pNextWindow) {
+        CWindow* curr = w;
+        do {
+            window.grouped.push_back(curr);
+            curr = curr->m_sGroupData.pNextWindow;
+        } while (curr != w);
+    }
+
+    return window;
+}
+
+static void snapshotMonitors(SHyprCtlSnapshot& snapshot) {
+    for (auto& m : g_pCompositor->m_vMonitors) {
+        if (!m->output)
+            continue;
+
+        const auto PWORKSPACE = g_pCompositor->getWorkspaceByID(m->activeWorkspace);
+
+        auto&      monitor          = snapshot.monitors.emplace_back();
+        monitor.address             = m.get();
+        monitor.id                  = m->ID;
+        monitor.name                = m->szName;
+        monitor.description         = m->output->description ? m->output->description : "";
+        monitor.make                = m->output->make ? m->output->make : "";
+        monitor.model               = m->output->model ? m->output->model : "";
+        monitor.serial              = m->output->serial ? m->output->serial : "";
+        monitor.pixelSize           = m->vecPixelSize;
+        monitor.refreshRate         = m->refreshRate;
+        monitor.position            = m->vecPosition;
+        monitor.activeWorkspace     = m->activeWorkspace;
+        monitor.activeWorkspaceName = PWORKSPACE ? PWORKSPACE->m_szName : "";
+        monitor.reservedTopLeft     = m->vecReservedTopLeft;
+        monitor.reservedBottomRight = m->vecReservedBottomRight;
+        monitor.scale               = m->scale;
+        monitor.transform           = (int)m->transform;
+        monitor.focused             = m.get() == g_pCompositor->m_pLastMonitor;
+        monitor.dpms                = m->dpmsStatus;
+        monitor.vrr                 = m->output->adaptive_sync_status == WLR_OUTPUT_ADAPTIVE_SYNC_ENABLED;
+    }
+}
+
+static void snapshotWindows(SHyprCtlSnapshot& snapshot) {
+    snapshot.activeWindow = -1;
+
+    for (auto& w : g_pCompositor->m_vWindows) {
+        if (w.get() == g_pCompositor->m_pLastWindow && g_pCompositor->windowValidMapped(w.get()))
+            snapshot.activeWindow = snapshot.windows.size();
+
+        snapshot.windows.emplace_back(snapshotWindow(w.get()));
+    }
+}
+
+static void snapshotWorkspaces(SHyprCtlSnapshot& snapshot) {
+    for (auto& w : g_pCompositor->m_vWorkspaces) {
+        const auto PLASTW   = w->getLastFocusedWindow();
+        const auto PMONITOR = g_pCompositor->getMonitorFromID(w->m_iMonitorID);
+
+        snapshot.workspaces.emplace_back(SWorkspaceSnapshot{w->m_iID, w->m_szName, PMONITOR ? PMONITOR->szName : "", g_pCompositor->getWindowsOnWorkspace(w->m_iID),
+                                                            w->m_bHasFullscreenWindow, PLASTW, PLASTW ? PLASTW->m_szTitle : ""});
+    }
+}
+
+static void snapshotLayers(SHyprCtlSnapshot& snapshot) {
+    for (auto& m : g_pCompositor->m_vMonitors) {
+        auto& monitor   = snapshot.layers.emplace_back();
+        monitor.monitor = m->szName;
+
+        for (size_t i = 0; i < m->m_aLayerSurfaceLayers.size() && i < monitor.levels.size(); ++i) {
+            for (auto& ls : m->m_aLayerSurfaceLayers[i]) {
+                monitor.levels[i].emplace_back(SLayerSnapshot{ls.get(), ls->geometry.x, ls->geometry.y, ls->geometry.width, ls->geometry.height, ls->szNamespace});
+            }
+        }
+    }
+}
+
+static void snapshotDevices(SHyprCtlSnapshot& snapshot) {
+    for (auto& m : g_pInputManager->m_lMice) {
+        snapshot.mice.emplace_back(SDeviceSnapshot{
+            &m, m.name,
+            wlr_input_device_is_libinput(m.mouse) ? (float)libinput_device_config_accel_get_default_speed((libinput_device*)wlr_libinput_get_device_handle(m.mouse)) : 0.f});
+    }
+
+    for (auto& k : g_pInputManager->m_lKeyboards) {
+        snapshot.keyboards.emplace_back(SKeyboardSnapshot{&k, k.name, k.currentRules.rules, k.currentRules.model, k.currentRules.layout, k.currentRules.variant,
+                                                          k.currentRules.options, g_pInputManager->getActiveLayoutForKeyboard(&k), k.active});
+    }
+
+    for (auto& d : g_pInputManager->m_lTabletPads) {
+        snapshot.tabletPads.emplace_back(SDeviceSnapshot{&d, "", 0, d.pTabletParent, d.pTabletParent ? d.pTabletParent->name : ""});
+    }
+
+    for (auto& d : g_pInputManager->m_lTablets) {
+        snapshot.tablets.emplace_back(SDeviceSnapshot{&d, d.name});
+    }
+
+    for (auto& d : g_pInputManager->m_lTabletTools) {
+        snapshot.tabletTools.emplace_back(SDeviceSnapshot{&d, "", 0, d.wlrTabletTool ? d.wlrTabletTool->data : nullptr});
+    }
+
+    for (auto& d : g_pInputManager->m_lTouchDevices) {
+        snapshot.touch.emplace_back(SDeviceSnapshot{&d, d.name});
+    }
+
+    for (auto& d : g_pInputManager->m_lSwitches) {
+        snapshot.switches.emplace_back(SDeviceSnapshot{&d, d.pWlrDevice ? d.pWlrDevice->name : ""});
+    }
+}
+
+// retakes the sections that changed, the rest is copied over from the last published one
+static void publishSnapshot() {
+    TRACE_SCOPE("ipc", "takeSnapshot");
+
+    const auto DIRTY    = publishedSnapshot ? dirtySections : (uint32_t)SNAPSHOT_ALL;
+    auto       snapshot = std::make_shared<SHyprCtlSnapshot>();
+
+    if (DIRTY & SNAPSHOT_MONITORS)
+        snapshotMonitors(*snapshot);
+    else
+        snapshot->monitors = publishedSnapshot->monitors;
+
+    if (DIRTY & SNAPSHOT_WINDOWS)
+        snapshotWindows(*snapshot);
+    else {
+        snapshot->windows      = publishedSnapshot->windows;
+        snapshot->activeWindow = publishedSnapshot->activeWindow;
+    }
+
+    if (DIRTY & SNAPSHOT_WORKSPACES)
+        snapshotWorkspaces(*snapshot);
+    else
+        snapshot->workspaces = publishedSnapshot->workspaces;
+
+    if (DIRTY & SNAPSHOT_LAYERS)
+        snapshotLayers(*snapshot);
+    else
+        snapshot->layers = publishedSnapshot->layers;
+
+    if (DIRTY & SNAPSHOT_DEVICES)
+        snapshotDevices(*snapshot);
+    else {
+        snapshot->mice        = publishedSnapshot->mice;
+        snapshot->tabletPads  = publishedSnapshot->tabletPads;
+        snapshot->tablets     = publishedSnapshot->tablets;
+        snapshot->tabletTools = publishedSnapshot->tabletTools;
+        snapshot->touch       = publishedSnapshot->touch;
+        snapshot->switches    = publishedSnapshot->switches;
+        snapshot->keyboards   = publishedSnapshot->keyboards;
+    }
+
+    dirtySections     = 0;
+    publishedSnapshot = snapshot;
+}
+
+static int onPublishTimer(void* data) {
+    if (dirtySections)
+        publishSnapshot();
+
+    return 0;
+}
+
+void HyprCtl::markStateChanged(uint32_t sections) {
+    const bool WASCLEAN = dirtySections == 0;
+
+    dirtySections |= sections;
+
+    // throttled, not debounced: the timer isn't pushed back by more changes
+    if (!WASCLEAN || !g_pCompositor || !g_pCompositor->m_sWLEventLoop)
+        return;
+
+    if (!publishTimer)
+        publishTimer = wl_event_loop_add_timer(g_pCompositor->m_sWLEventLoop, onPublishTimer, nullptr);
+
+    wl_event_source_timer_update(publishTimer, SNAPSHOT_PUBLISH_DELAY_MS);
+}
+
+std::shared_ptr<const SHyprCtlSnapshot> HyprCtl::getSnapshot() {
+    // a query right after a change doesn't wait for the timer
+    if (!publishedSnapshot || dirtySections)
+        publishSnapshot();
+
+    return publishedSnapshot;
+}
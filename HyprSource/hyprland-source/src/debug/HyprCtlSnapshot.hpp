@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../helpers/Vector2D.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// plain copies of everything the read-only hyprctl queries print.
+// taken on the main thread, never modified afterwards, so any thread may format replies from it.
+
+struct SMonitorSnapshot {
+    void*       address = nullptr;
+    int         id      = -1;
+    std::string name, description, make, model, serial;
+    Vector2D    pixelSize;
+    float       refreshRate = 0;
+    Vector2D    position;
+    int         activeWorkspace = -1;
+    std::string activeWorkspaceName;
+    Vector2D    reservedTopLeft, reservedBottomRight;
+    float       scale     = 1;
+    int         transform = 0;
+    bool        focused   = false;
+    bool        dpms      = false;
+    bool        vrr       = false;
+};
+
+struct SWindowSnapshot {
+    void*              address = nullptr;
+    bool               mapped  = false;
+    bool               hidden  = false;
+    Vector2D           position, size;
+    int                workspaceID = -1;
+    std::string        workspaceName;
+    bool               floating = false;
+    int                monitor  = -1;
+    std::string        windowClass, title, initialClass, initialTitle;
+    int                pid            = 0;
+    bool               xwayland       = false;
+    bool               pinned         = false;
+    bool               fullscreen     = false;
+    int                fullscreenMode = 0;
+    bool               fakeFullscreen = false;
+    std::vector<void*> grouped;
+    void*              swallowing = nullptr;
+};
+
+struct SWorkspaceSnapshot {
+    int         id = -1;
+    std::string name, monitor;
+    int         windows       = 0;
+    bool        hasFullscreen = false;
+    void*       lastWindow    = nullptr;
+    std::string lastWindowTitle;
+};
+
+struct SLayerSnapshot {
+    void*       address = nullptr;
+    int         x = 0, y = 0, w = 0, h = 0;
+    std::string ns;
+};
+
+struct SMonitorLayersSnapshot {
+    std::string                                monitor;
+    std::array<std::vector<SLayerSnapshot>, 4> levels;
+};
+
+struct SDeviceSnapshot {
+    void*       address = nullptr;
+    std::string name;
+    float       defaultSpeed = 0;     // mice
+    void*       parent       = nullptr; // tablet pads and tools
+    std::string parentName;             // tablet pads
+};
+
+struct SKeyboardSnapshot {
+    void*       address = nullptr;
+    std::string name, rules, model, layout, variant, options, activeKeymap;
+    bool        main = false;
+};
+
+struct SHyprCtlSnapshot {
+    std::vector<SMonitorSnapshot>       monitors;
+    std::vector<SWindowSnapshot>        windows;
+    std::vector<SWorkspaceSnapshot>     workspaces;
+    std::vector<SMonitorLayersSnapshot> layers;
+
+    // index into windows, -1 if there is no valid active window
+    int                                 activeWindow = -1;
+
+    std::vector<SDeviceSnapshot>        mice, tabletPads, tablets, tabletTools, touch, switches;
+    std::vector<SKeyboardSnapshot>      keyboards;
+};
+
+enum eSnapshotSection : uint32_t
+{
+    SNAPSHOT_MONITORS   = 1 << 0,
+    SNAPSHOT_WINDOWS    = 1 << 1,
+    SNAPSHOT_WORKSPACES = 1 << 2,
+    SNAPSHOT_LAYERS     = 1 << 3,
+    SNAPSHOT_DEVICES    = 1 << 4,
+
+    SNAPSHOT_ALL = SNAPSHOT_MONITORS | SNAPSHOT_WINDOWS | SNAPSHOT_WORKSPACES | SNAPSHOT_LAYERS | SNAPSHOT_DEVICES,
+};
+
+namespace HyprCtl {
+    // how long changes pile up before the snapshot is republished
+    constexpr int SNAPSHOT_PUBLISH_DELAY_MS = 50;
+
+    // main thread only. call on anything a query could observe (map, focus, geometry, config...), only the given sections are retaken.
+    void                                    markStateChanged(uint32_t sections = SNAPSHOT_ALL);
+
+    // main thread only. returns the published snapshot, retaking the sections that changed since first.
+    std::shared_ptr<const SHyprCtlSnapshot> getSnapshot();
+};
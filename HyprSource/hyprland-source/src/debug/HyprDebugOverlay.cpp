@@ -173,6 +173,27 @@ int CHyprMonitorDebugOverlay::draw(int offset) {
     if (cairoExtents.width > maxX)
         maxX = cairoExtents.width;
 
+    yOffset += 11;
+    cairo_move_to(g_pDebugOverlay->m_pCairo, 0, yOffset);
+    text = std::string(getFormat("Input Latency: %.2fms (p99 %.2fms)", m_pMonitor->frameStats.inputLatency.average(), m_pMonitor->frameStats.inputLatency.percentile(0.99f)));
+    cairo_show_text(g_pDebugOverlay->m_pCairo, text.c_str());
+    cairo_text_extents(g_pDebugOverlay->m_pCairo, text.c_str(), &cairoExtents);
+    if (cairoExtents.width > maxX)
+        maxX = cairoExtents.width;
+
+    // only there with debug:gpu_timers and a driver that supports them
+    if (const auto IT = g_pHyprOpenGL->m_GPUTimers.m_mTimes.find(m_pMonitor); IT != g_pHyprOpenGL->m_GPUTimers.m_mTimes.end()) {
+        for (size_t i = 0; i < GPU_PASS_COUNT; ++i) {
+            yOffset += 11;
+            cairo_move_to(g_pDebugOverlay->m_pCairo, 0, yOffset);
+            text = std::string(getFormat("GPU %s: %.2fms", GPU_PASS_NAMES[i], IT->second.smoothed[i]));
+            cairo_show_text(g_pDebugOverlay->m_pCairo, text.c_str());
+            cairo_text_extents(g_pDebugOverlay->m_pCairo, text.c_str(), &cairoExtents);
+            if (cairoExtents.width > maxX)
+                maxX = cairoExtents.width;
+        }
+    }
+
     yOffset += 11;
 
     g_pHyprRenderer->damageBox(&m_wbLastDrawnBox);
@@ -1,68 +1,176 @@
 #include "Log.hpp"
 #include "../defines.hpp"
 #include "../Compositor.hpp"
+#include "../helpers/RingBuffer.hpp"
 
 #include <fstream>
 #include <iostream>
+#include <condition_variable>
+
+// a queued line, the prefix and timestamp are only formatted by the writer
+struct SLogEntry {
+    LogLevel                              level = NONE;
+    bool                                  wlr   = false;
+    bool                                  time  = false;
+    bool                                  print = false;
+    std::chrono::system_clock::time_point stamp;
+    std::string                           message;
+};
+
+// producers never touch the file, they push to the queue and the writer thread drains it in batches.
+// never destroyed, the detached writer may still be waiting on it while statics go away at exit
+struct SLogState {
+    CRingBuffer<SLogEntry, 4096> queue;
+    std::atomic<size_t>          queued = 0;
+    std::mutex                   writeMutex; // held while draining, the writer and flush() may race
+    std::mutex                   wakeMutex;
+    std::condition_variable      wakeCV;
+    std::ofstream                stream;
+};
+
+static SLogState* const LOGSTATE = new SLogState();
+
+static void writeEntry(const SLogEntry& entry) {
+    switch (entry.wlr ? NONE : entry.level) {
+        case LOG: LOGSTATE->stream << "[LOG] "; break;
+        case WARN: LOGSTATE->stream << "[WARN] "; break;
+        case ERR: LOGSTATE->stream << "[ERR] "; break;
+        case CRIT: LOGSTATE->stream << "[CRITICAL] "; break;
+        case INFO: LOGSTATE->stream << "[INFO] "; break;
+        default: break;
+    }
 
-void Debug::init(const std::string& IS) {
-    logFile = "/tmp/hypr/" + IS + (ISDEBUG ? "/hyprlandd.log" : "/hyprland.log");
-}
-
-void Debug::wlrLog(wlr_log_importance level, const char* fmt, va_list args) {
-    char*         outputStr = nullptr;
+    if (entry.wlr)
+        LOGSTATE->stream << "[wlr] ";
 
-    std::ofstream ofs;
-    ofs.open(logFile, std::ios::out | std::ios::app);
+    if (entry.time) {
+        const auto TIMET  = std::chrono::system_clock::to_time_t(entry.stamp);
+        const auto MILLIS = std::chrono::duration_cast<std::chrono::milliseconds>(entry.stamp.time_since_epoch()).count() % 1000;
+        std::tm    local;
+        localtime_r(&TIMET, &local);
 
-    vasprintf(&outputStr, fmt, args);
+        LOGSTATE->stream << std::put_time(&local, "[%H:%M:%S:");
 
-    std::string output = std::string(outputStr);
-    free(outputStr);
+        if (MILLIS > 99)
+            LOGSTATE->stream << MILLIS;
+        else if (MILLIS > 9)
+            LOGSTATE->stream << "0" << MILLIS;
+        else
+            LOGSTATE->stream << "00" << MILLIS;
 
-    ofs << "[wlr] " << output << "\n";
+        LOGSTATE->stream << "] ";
+    }
 
-    ofs.close();
+    LOGSTATE->stream << entry.message << "\n";
 
-    if (!disableStdout)
-        std::cout << output << "\n";
+    // log it to the stdout too.
+    if (entry.print)
+        std::cout << entry.message << "\n";
 }
 
-void Debug::log(LogLevel level, const char* fmt, ...) {
+// writeMutex has to be held
+static void drainLogQueueLocked() {
+    if (!LOGSTATE->stream.is_open()) {
+        if (Debug::logFile.empty())
+            return; // keep queueing until init()
 
-    if (disableLogs && *disableLogs)
-        return;
+        LOGSTATE->stream.open(Debug::logFile, std::ios::out | std::ios::app);
+    }
 
-    // log to a file
-    std::ofstream ofs;
-    ofs.open(logFile, std::ios::out | std::ios::app);
+    SLogEntry entry;
+    bool      wrote = false;
+    while (LOGSTATE->queue.pop(entry)) {
+        LOGSTATE->queued.fetch_sub(1, std::memory_order_relaxed);
+        writeEntry(entry);
+        wrote = true;
+    }
 
-    switch (level) {
-        case LOG: ofs << "[LOG] "; break;
-        case WARN: ofs << "[WARN] "; break;
-        case ERR: ofs << "[ERR] "; break;
-        case CRIT: ofs << "[CRITICAL] "; break;
-        case INFO: ofs << "[INFO] "; break;
-        default: break;
+    if (wrote) {
+        LOGSTATE->stream.flush();
+        std::cout.flush();
     }
+}
 
-    // print date and time to the ofs
-    if (disableTime && !*disableTime) {
-        auto       timet  = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-        const auto MILLIS = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() % 1000;
+static void drainLogQueue() {
+    std::lock_guard<std::mutex> lg(LOGSTATE->writeMutex);
+    drainLogQueueLocked();
+}
 
-        ofs << std::put_time(std::localtime(&timet), "[%H:%M:%S:");
+static void logWriterThread() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lk(LOGSTATE->wakeMutex);
+            LOGSTATE->wakeCV.wait_for(lk, std::chrono::milliseconds(50), [] { return LOGSTATE->queued.load(std::memory_order_relaxed) >= 1024; });
+        }
 
-        if (MILLIS > 99)
-            ofs << MILLIS;
-        else if (MILLIS > 9)
-            ofs << "0" << MILLIS;
-        else
-            ofs << "00" << MILLIS;
+        drainLogQueue();
+    }
+}
+
+static void queueEntry(SLogEntry&& entry) {
+    const bool CRITICAL = entry.level == CRIT;
+
+    // full, write it out ourselves rather than lose lines.
+    // before init() there's nowhere to write to, drop the oldest line instead
+    while (!LOGSTATE->queue.push(std::move(entry))) {
+        if (!Debug::logFile.empty()) {
+            drainLogQueue();
+            continue;
+        }
 
-        ofs << "] ";
+        SLogEntry dropped;
+        if (LOGSTATE->queue.pop(dropped))
+            LOGSTATE->queued.fetch_sub(1, std::memory_order_relaxed);
     }
 
+    // the writer wakes up on its own every 50ms, only poke it when it falls behind
+    if (LOGSTATE->queued.fetch_add(1, std::memory_order_relaxed) + 1 == 1024)
+        LOGSTATE->wakeCV.notify_one();
+
+    // we might be about to die, get it on disk now
+    if (CRITICAL)
+        Debug::flush();
+}
+
+void Debug::init(const std::string& IS) {
+    logFile = "/tmp/hypr/" + IS + (ISDEBUG ? "/hyprlandd.log" : "/hyprland.log");
+
+    std::thread(logWriterThread).detach();
+    std::atexit(Debug::flush);
+}
+
+void Debug::flush() {
+    drainLogQueue();
+}
+
+void Debug::emergencyFlush() {
+    std::unique_lock<std::mutex> lk(LOGSTATE->writeMutex, std::defer_lock);
+
+    // the writer may just be busy, but if we crashed while draining, the lock is never coming back
+    for (int i = 0; i < EMERGENCY_FLUSH_ATTEMPTS && !lk.try_lock(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    if (!lk.owns_lock())
+        return;
+
+    drainLogQueueLocked();
+}
+
+void Debug::wlrLog(wlr_log_importance level, const char* fmt, va_list args) {
+    char* outputStr = nullptr;
+
+    vasprintf(&outputStr, fmt, args);
+
+    SLogEntry entry;
+    entry.wlr     = true;
+    entry.print   = !disableStdout;
+    entry.message = std::string(outputStr);
+    free(outputStr);
+
+    queueEntry(std::move(entry));
+}
+
+void Debug::logUnfiltered(LogLevel level, const char* fmt, ...) {
     char*   outputStr = nullptr;
 
     va_list args;
@@ -70,14 +178,13 @@ void Debug::log(LogLevel level, const char* fmt, ...) {
     vasprintf(&outputStr, fmt, args);
     va_end(args);
 
-    std::string output = std::string(outputStr);
+    SLogEntry entry;
+    entry.level   = level;
+    entry.time    = disableTime && !*disableTime;
+    entry.print   = !disableStdout;
+    entry.stamp   = entry.time ? std::chrono::system_clock::now() : std::chrono::system_clock::time_point{};
+    entry.message = std::string(outputStr);
     free(outputStr);
 
-    ofs << output << "\n";
-
-    ofs.close();
-
-    // log it to the stdout too.
-    if (!disableStdout)
-        std::cout << output << "\n";
+    queueEntry(std::move(entry));
 }
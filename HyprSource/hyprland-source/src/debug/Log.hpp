@@ -4,6 +4,14 @@
 
 #define LOGMESSAGESIZE 1024
 
+// how many times emergencyFlush() tries to take the write lock, 10ms apart
+#define EMERGENCY_FLUSH_ATTEMPTS 10
+
+// levels below this are compiled out, set with -DHYPRLAND_LOG_MIN_LEVEL=1 (WARN) etc.
+#ifndef HYPRLAND_LOG_MIN_LEVEL
+#define HYPRLAND_LOG_MIN_LEVEL 0
+#endif
+
 enum LogLevel
 {
     NONE = -1,
@@ -16,11 +24,40 @@ enum LogLevel
 
 namespace Debug {
     void               init(const std::string& IS);
-    void               log(LogLevel level, const char* fmt, ...);
     void               wlrLog(wlr_log_importance level, const char* fmt, va_list args);
 
+    // writes out everything still queued, done automatically at exit and on CRIT
+    void               flush();
+
+    // flush() for the crash handler, gives up instead of deadlocking if the lock is held for good
+    void               emergencyFlush();
+
+    // formats and queues the message, log() calls this only for enabled levels
+    void               logUnfiltered(LogLevel level, const char* fmt, ...);
+
     inline std::string logFile;
     inline int64_t*    disableLogs   = nullptr;
     inline int64_t*    disableTime   = nullptr;
+    inline int64_t*    minLevel      = nullptr;
     inline bool        disableStdout = false;
-};
\ No newline at end of file
+
+    inline bool        enabled(LogLevel level) {
+        if (disableLogs && *disableLogs)
+            return false;
+
+        // plain (NONE) and INFO lines are never filtered by level
+        if (level == NONE || level == INFO)
+            return true;
+
+        return level >= HYPRLAND_LOG_MIN_LEVEL && (!minLevel || level >= *minLevel);
+    }
+
+    // nothing gets formatted for disabled levels
+    template <typename... Args>
+    inline void log(LogLevel level, const char* fmt, Args... args) {
+        if (!enabled(level))
+            return;
+
+        logUnfiltered(level, fmt, args...);
+    }
+};
@@ -0,0 +1,174 @@
+#include "Tracing.hpp"
+#include "../helpers/JSONWriter.hpp"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+struct STraceEvent {
+    const char* category = nullptr;
+    const char* name     = nullptr;
+    uint64_t    begin    = 0;
+    uint64_t    end      = 0;
+};
+
+// relaxed atomics so dump() can read slots the owning thread may be overwriting, torn copies are dropped after
+struct STraceSlot {
+    std::atomic<const char*> category = nullptr;
+    std::atomic<const char*> name     = nullptr;
+    std::atomic<uint64_t>    begin    = 0;
+    std::atomic<uint64_t>    end      = 0;
+};
+
+// written only by its own thread, read by dump() which drops whatever got overwritten while it copied
+struct SThreadTraceBuffer {
+    pid_t                                       tid = 0;
+    std::string                                 name;
+    std::array<STraceSlot, TRACE_BUFFER_EVENTS> events;
+    std::atomic<uint64_t>                       head = 0;
+};
+
+// buffers outlive their threads so a dump still has events from threads that exited
+static std::mutex                                       traceBuffersMutex;
+static std::vector<std::unique_ptr<SThreadTraceBuffer>> traceBuffers;
+static std::atomic<uint64_t>                            traceStart = 0;
+static std::atomic<uint64_t>                            traceStop  = 0;
+
+static thread_local SThreadTraceBuffer*                 localBuffer = nullptr;
+static thread_local const char*                         localName   = nullptr;
+
+static SThreadTraceBuffer*                              registerThread() {
+    auto buffer = std::make_unique<SThreadTraceBuffer>();
+    buffer->tid = syscall(SYS_gettid);
+
+    if (localName)
+        buffer->name = localName;
+    else {
+        char name[16] = {0};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        buffer->name = name;
+    }
+
+    std::lock_guard<std::mutex> lg(traceBuffersMutex);
+    return traceBuffers.emplace_back(std::move(buffer)).get();
+}
+
+uint64_t Tracing::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Tracing::record(const char* category, const char* name, uint64_t begin, uint64_t end) {
+    if (!localBuffer)
+        localBuffer = registerThread();
+
+    const auto HEAD = localBuffer->head.load(std::memory_order_relaxed);
+    auto&      slot = localBuffer->events[HEAD % TRACE_BUFFER_EVENTS];
+
+    slot.category.store(category, std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.begin.store(begin, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+
+    localBuffer->head.store(HEAD + 1, std::memory_order_release);
+}
+
+void Tracing::setThreadName(const char* name) {
+    localName = name;
+
+    if (localBuffer) {
+        std::lock_guard<std::mutex> lg(traceBuffersMutex);
+        localBuffer->name = name;
+    }
+}
+
+void Tracing::start() {
+    traceStart = now();
+    traceStop  = 0;
+    enabled    = true;
+}
+
+void Tracing::stop() {
+    enabled   = false;
+    traceStop = now();
+}
+
+// copies out the events of one buffer belonging to the current trace
+static std::vector<STraceEvent> collectEvents(SThreadTraceBuffer* buffer) {
+    const auto               HEAD  = buffer->head.load(std::memory_order_acquire);
+    const auto               FIRST = HEAD > TRACE_BUFFER_EVENTS ? HEAD - TRACE_BUFFER_EVENTS : 0;
+
+    std::vector<STraceEvent> events;
+    events.reserve(HEAD - FIRST);
+    for (auto i = FIRST; i < HEAD; ++i) {
+        const auto& SLOT = buffer->events[i % TRACE_BUFFER_EVENTS];
+        events.push_back({SLOT.category.load(std::memory_order_relaxed), SLOT.name.load(std::memory_order_relaxed), SLOT.begin.load(std::memory_order_relaxed),
+                          SLOT.end.load(std::memory_order_relaxed)});
+    }
+
+    // the thread may have lapped us while copying, those slots hold newer events than we think
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto NEWHEAD = buffer->head.load(std::memory_order_relaxed);
+    if (NEWHEAD > TRACE_BUFFER_EVENTS && NEWHEAD - TRACE_BUFFER_EVENTS > FIRST)
+        events.erase(events.begin(), events.begin() + std::min<uint64_t>(NEWHEAD - TRACE_BUFFER_EVENTS - FIRST, events.size()));
+
+    const auto START = traceStart.load();
+    const auto STOP  = traceStop.load();
+    std::erase_if(events, [&](const auto& ev) { return ev.begin < START || (STOP && ev.end > STOP); });
+
+    return events;
+}
+
+size_t Tracing::eventCount() {
+    std::lock_guard<std::mutex> lg(traceBuffersMutex);
+
+    size_t                      count = 0;
+    for (auto& b : traceBuffers)
+        count += collectEvents(b.get()).size();
+
+    return count;
+}
+
+std::string Tracing::dump() {
+    std::lock_guard<std::mutex> lg(traceBuffersMutex);
+
+    const auto                  PID   = getpid();
+    const auto                  START = traceStart.load();
+
+    std::string                 result = "";
+    CJSONWriter                 json(result);
+    json.beginObject();
+    json.key("displayTimeUnit").string("ms");
+    json.key("traceEvents").beginArray();
+
+    for (auto& b : traceBuffers) {
+        json.beginObject();
+        json.key("name").string("thread_name");
+        json.key("ph").string("M");
+        json.key("pid").integer(PID);
+        json.key("tid").integer(b->tid);
+        json.key("args").beginObject().key("name").string(b->name).endObject();
+        json.endObject();
+
+        for (auto& ev : collectEvents(b.get())) {
+            json.beginObject();
+            json.key("name").string(ev.name);
+            json.key("cat").string(ev.category);
+            json.key("ph").string("X");
+            json.key("pid").integer(PID);
+            json.key("tid").integer(b->tid);
+            json.key("ts").number((ev.begin - START) / 1000.0, 3);
+            json.key("dur").number((ev.end - ev.begin) / 1000.0, 3);
+            json.endObject();
+        }
+    }
+
+    json.endArray();
+    json.endObject();
+
+    return result;
+}
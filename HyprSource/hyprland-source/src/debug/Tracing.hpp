@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// per-thread timeline tracing, off until "hyprctl trace start". when off a TRACE_SCOPE costs one relaxed load.
+// "hyprctl trace dump" exports the chrome trace event format, which chrome://tracing and ui.perfetto.dev both open.
+#define TRACE_CONCAT_IMPL(a, b)     a##b
+#define TRACE_CONCAT(a, b)          TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(category, name) CTraceScope TRACE_CONCAT(traceScope, __LINE__)(category, name)
+
+// events kept per thread, older ones are overwritten
+#define TRACE_BUFFER_EVENTS 65536
+
+namespace Tracing {
+    inline std::atomic<bool> enabled = false;
+
+    uint64_t                 now(); // steady clock, ns
+
+    // category and name have to be string literals, only the pointers are stored
+    void        record(const char* category, const char* name, uint64_t begin, uint64_t end);
+    void        setThreadName(const char* name);
+
+    void        start(); // starts a new trace, events from before are not dumped
+    void        stop();
+    size_t      eventCount();
+    std::string dump();
+};
+
+class CTraceScope {
+  public:
+    CTraceScope(const char* category, const char* name) : m_szCategory(category), m_szName(name) {
+        if (Tracing::enabled.load(std::memory_order_relaxed))
+            m_iBegin = Tracing::now();
+    }
+
+    ~CTraceScope() {
+        if (m_iBegin)
+            Tracing::record(m_szCategory, m_szName, m_iBegin, Tracing::now());
+    }
+
+    CTraceScope(const CTraceScope&)            = delete;
+    CTraceScope& operator=(const CTraceScope&) = delete;
+
+  private:
+    const char* m_szCategory = nullptr;
+    const char* m_szName     = nullptr;
+    uint64_t    m_iBegin     = 0;
+};
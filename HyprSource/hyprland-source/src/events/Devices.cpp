@@ -58,9 +58,15 @@ void Events::listener_requestMouse(wl_listener* listener, void* data) {
     g_pInputManager->processMouseRequest(EVENT);
 }
 
+void Events::listener_pointerFocusChange(wl_listener* listener, void* data) {
+    g_pInputManager->onPointerFocusChange((wlr_seat_pointer_focus_change_event*)data);
+}
+
 void Events::listener_newInput(wl_listener* listener, void* data) {
     const auto DEVICE = (wlr_input_device*)data;
 
+    HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
+
     switch (DEVICE->type) {
         case WLR_INPUT_DEVICE_KEYBOARD:
             Debug::log(LOG, "Attached a keyboard with name %s", DEVICE->name);
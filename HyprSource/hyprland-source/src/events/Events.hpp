@@ -87,6 +87,7 @@ namespace Events {
 
     // Various
     LISTENER(requestMouse);
+    LISTENER(pointerFocusChange);
     LISTENER(requestSetSel);
     LISTENER(requestSetPrimarySel);
 
@@ -100,6 +101,7 @@ namespace Events {
     DYNLISTENFUNC(monitorStateRequest);
     DYNLISTENFUNC(monitorDamage);
     DYNLISTENFUNC(monitorNeedsFrame);
+    DYNLISTENFUNC(monitorPresent);
 
     // XWayland
     LISTENER(readyXWayland);
@@ -114,6 +114,9 @@ void Events::listener_newOutput(wl_listener* listener, void* data) {
 void Events::listener_monitorFrame(void* owner, void* data) {
     CMonitor* const PMONITOR = (CMonitor*)owner;
 
+    // resolve coalesced pointer motion once per frame, before the frame is built
+    g_pInputManager->flushPendingMouseMove();
+
     if ((g_pCompositor->m_sWLRSession && !g_pCompositor->m_sWLRSession->active) || !g_pCompositor->m_bSessionActive || g_pCompositor->m_bUnsafeState) {
         Debug::log(WARN, "Attempted to render frame on inactive session!");
 
@@ -126,8 +129,8 @@ void Events::listener_monitorFrame(void* owner, void* data) {
     if (!PMONITOR->m_bEnabled)
         return;
 
-    static auto* const PENABLERAT = &g_pConfigManager->getConfigValuePtr("misc:render_ahead_of_time")->intValue;
-    static auto* const PRATSAFE   = &g_pConfigManager->getConfigValuePtr("misc:render_ahead_safezone")->intValue;
+    static auto* const PENABLERAT = &g_pConfigManager->getConfigValuePtr(CFG_MISC_RENDER_AHEAD_OF_TIME)->intValue;
+    static auto* const PRATSAFE   = &g_pConfigManager->getConfigValuePtr(CFG_MISC_RENDER_AHEAD_SAFEZONE)->intValue;
 
     PMONITOR->lastPresentationTimer.reset();
 
@@ -209,3 +212,10 @@ void Events::listener_monitorNeedsFrame(void* owner, void* data) {
 
     g_pCompositor->scheduleFrameForMonitor(PMONITOR);
 }
+
+void Events::listener_monitorPresent(void* owner, void* data) {
+    const auto PMONITOR = (CMonitor*)owner;
+    const auto E        = (wlr_output_event_present*)data;
+
+    PMONITOR->frameStats.onPresent(E->commit_seq, E->presented, E->when, E->refresh, PMONITOR->refreshRate);
+}
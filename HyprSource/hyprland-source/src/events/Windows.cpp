@@ -40,11 +40,11 @@ void setAnimToMove(void* data) {
 void Events::listener_mapWindow(void* owner, void* data) {
     CWindow*           PWINDOW = (CWindow*)owner;
 
-    static auto* const PINACTIVEALPHA = &g_pConfigManager->getConfigValuePtr("decoration:inactive_opacity")->floatValue;
-    static auto* const PACTIVEALPHA   = &g_pConfigManager->getConfigValuePtr("decoration:active_opacity")->floatValue;
-    static auto* const PDIMSTRENGTH   = &g_pConfigManager->getConfigValuePtr("decoration:dim_strength")->floatValue;
-    static auto* const PSWALLOW       = &g_pConfigManager->getConfigValuePtr("misc:enable_swallow")->intValue;
-    static auto* const PSWALLOWREGEX  = &g_pConfigManager->getConfigValuePtr("misc:swallow_regex")->strValue;
+    static auto* const PINACTIVEALPHA = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_INACTIVE_OPACITY)->floatValue;
+    static auto* const PACTIVEALPHA   = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ACTIVE_OPACITY)->floatValue;
+    static auto* const PDIMSTRENGTH   = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DIM_STRENGTH)->floatValue;
+    static auto* const PSWALLOW       = &g_pConfigManager->getConfigValuePtr(CFG_MISC_ENABLE_SWALLOW)->intValue;
+    static auto* const PSWALLOWREGEX  = &g_pConfigManager->getConfigValuePtr(CFG_MISC_SWALLOW_REGEX)->strValue;
 
     auto               PMONITOR = g_pCompositor->m_pLastMonitor;
     const auto         PWORKSPACE =
@@ -572,7 +572,7 @@ void Events::listener_mapWindow(void* owner, void* data) {
 
     auto workspaceID = requestedWorkspace != "" ? requestedWorkspace : PWORKSPACE->m_szName;
     g_pEventManager->postEvent(
-        SHyprIPCEvent{"openwindow", getFormat("%x,%s,%s,%s", PWINDOW, workspaceID.c_str(), g_pXWaylandManager->getAppIDClass(PWINDOW).c_str(), PWINDOW->m_szTitle.c_str())});
+        windowIPCEvent("openwindow", getFormat("%x,%s,%s,%s", PWINDOW, workspaceID.c_str(), g_pXWaylandManager->getAppIDClass(PWINDOW).c_str(), PWINDOW->m_szTitle.c_str()), PWINDOW));
     EMIT_HOOK_EVENT("openWindow", PWINDOW);
 
     // recalc the values for this window
@@ -592,7 +592,7 @@ void Events::listener_unmapWindow(void* owner, void* data) {
         return;
     }
 
-    g_pEventManager->postEvent(SHyprIPCEvent{"closewindow", getFormat("%x", PWINDOW)});
+    g_pEventManager->postEvent(windowIPCEvent("closewindow", getFormat("%x", PWINDOW), PWINDOW));
     EMIT_HOOK_EVENT("closeWindow", PWINDOW);
 
     g_pProtocolManager->m_pToplevelExportProtocolManager->onWindowUnmap(PWINDOW);
@@ -766,10 +766,13 @@ void Events::listener_setTitleWindow(void* owner, void* data) {
         return;
 
     PWINDOW->m_szTitle = g_pXWaylandManager->getTitle(PWINDOW);
+    HyprCtl::markStateChanged(SNAPSHOT_WINDOWS | SNAPSHOT_WORKSPACES);
 
     if (PWINDOW == g_pCompositor->m_pLastWindow) { // if it's the active, let's post an event to update others
-        g_pEventManager->postEvent(SHyprIPCEvent{"activewindow", g_pXWaylandManager->getAppIDClass(PWINDOW) + "," + PWINDOW->m_szTitle});
-        g_pEventManager->postEvent(SHyprIPCEvent{"activewindowv2", getFormat("%x", PWINDOW)});
+        if (g_pEventManager->wantsEvent("activewindow"))
+            g_pEventManager->postEvent(windowIPCEvent("activewindow", g_pXWaylandManager->getAppIDClass(PWINDOW) + "," + PWINDOW->m_szTitle, PWINDOW));
+        if (g_pEventManager->wantsEvent("activewindowv2"))
+            g_pEventManager->postEvent(windowIPCEvent("activewindowv2", getFormat("%x", PWINDOW), PWINDOW));
         EMIT_HOOK_EVENT("activeWindow", PWINDOW);
     }
 
@@ -842,7 +845,7 @@ void Events::listener_fullscreenWindow(void* owner, void* data) {
 void Events::listener_activateXDG(wl_listener* listener, void* data) {
     const auto         E = (wlr_xdg_activation_v1_request_activate_event*)data;
 
-    static auto* const PFOCUSONACTIVATE = &g_pConfigManager->getConfigValuePtr("misc:focus_on_activate")->intValue;
+    static auto* const PFOCUSONACTIVATE = &g_pConfigManager->getConfigValuePtr(CFG_MISC_FOCUS_ON_ACTIVATE)->intValue;
 
     Debug::log(LOG, "Activate request for surface at %x", E->surface);
 
@@ -854,7 +857,7 @@ void Events::listener_activateXDG(wl_listener* listener, void* data) {
     if (!PWINDOW || PWINDOW == g_pCompositor->m_pLastWindow)
         return;
 
-    g_pEventManager->postEvent(SHyprIPCEvent{"urgent", getFormat("%x", PWINDOW)});
+    g_pEventManager->postEvent(windowIPCEvent("urgent", getFormat("%x", PWINDOW), PWINDOW));
     EMIT_HOOK_EVENT("urgent", PWINDOW);
 
     PWINDOW->m_bIsUrgent = true;
@@ -878,7 +881,7 @@ void Events::listener_activateXDG(wl_listener* listener, void* data) {
 void Events::listener_activateX11(void* owner, void* data) {
     const auto         PWINDOW = (CWindow*)owner;
 
-    static auto* const PFOCUSONACTIVATE = &g_pConfigManager->getConfigValuePtr("misc:focus_on_activate")->intValue;
+    static auto* const PFOCUSONACTIVATE = &g_pConfigManager->getConfigValuePtr(CFG_MISC_FOCUS_ON_ACTIVATE)->intValue;
 
     Debug::log(LOG, "X11 Activate request for window %x", PWINDOW);
 
@@ -896,7 +899,7 @@ void Events::listener_activateX11(void* owner, void* data) {
     if (PWINDOW == g_pCompositor->m_pLastWindow)
         return;
 
-    g_pEventManager->postEvent(SHyprIPCEvent{"urgent", getFormat("%x", PWINDOW)});
+    g_pEventManager->postEvent(windowIPCEvent("urgent", getFormat("%x", PWINDOW), PWINDOW));
     EMIT_HOOK_EVENT("urgent", PWINDOW);
 
     if (!*PFOCUSONACTIVATE)
@@ -1077,13 +1080,13 @@ void Events::listener_requestMinimize(void* owner, void* data) {
 
         const auto E = (wlr_xwayland_minimize_event*)data;
 
-        g_pEventManager->postEvent({"minimize", getFormat("%x,%i", PWINDOW, (int)E->minimize)});
+        g_pEventManager->postEvent(windowIPCEvent("minimize", getFormat("%x,%i", PWINDOW, (int)E->minimize), PWINDOW));
         EMIT_HOOK_EVENT("minimize", (std::vector<void*>{PWINDOW, (void*)E->minimize}));
 
         wlr_xwayland_surface_set_minimized(PWINDOW->m_uSurface.xwayland, E->minimize && g_pCompositor->m_pLastWindow != PWINDOW); // fucking DXVK
     } else {
         const auto E = (wlr_foreign_toplevel_handle_v1_minimized_event*)data;
-        g_pEventManager->postEvent({"minimize", getFormat("%x,%i", PWINDOW, E ? (int)E->minimized : 1)});
+        g_pEventManager->postEvent(windowIPCEvent("minimize", getFormat("%x,%i", PWINDOW, E ? (int)E->minimized : 1), PWINDOW));
         EMIT_HOOK_EVENT("minimize", (std::vector<void*>{PWINDOW, (void*)(E ? (uint64_t)E->minimized : 1)}));
     }
 }
@@ -1,6 +1,7 @@
 #include "AnimatedVariable.hpp"
 #include "../managers/AnimationManager.hpp"
 #include "../config/ConfigManager.hpp"
+#include "../debug/HyprCtlSnapshot.hpp"
 
 CAnimatedVariable::CAnimatedVariable() {
     ; // dummy var
@@ -71,6 +72,12 @@ float CAnimatedVariable::getPercent() {
     return std::clamp((DURATIONPASSED / 100.f) / m_pConfig->pValues->internalSpeed, 0.f, 1.f);
 }
 
+void CAnimatedVariable::onGoalChanged() {
+    // a window's position or size, hyprctl reports the goal
+    if (m_pWindow && m_eVarType == AVARTYPE_VECTOR)
+        HyprCtl::markStateChanged(SNAPSHOT_WINDOWS);
+}
+
 float CAnimatedVariable::getCurveValue() {
     const auto SPENT = getPercent();
 
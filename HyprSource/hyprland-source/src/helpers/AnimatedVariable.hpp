@@ -70,6 +70,7 @@ class CAnimatedVariable {
         animationBegin = std::chrono::system_clock::now();
         m_vBegun       = m_vValue;
 
+        onGoalChanged();
         onAnimationBegin();
 
         return *this;
@@ -125,6 +126,7 @@ class CAnimatedVariable {
     // Sets the actual value and goal
     void setValueAndWarp(const Vector2D& v) {
         m_vGoal = v;
+        onGoalChanged();
         warp();
     }
 
@@ -251,6 +253,8 @@ class CAnimatedVariable {
     std::function<void(void* thisptr)>    m_fBeginCallback;
 
     // methods
+    void onGoalChanged();
+
     void onAnimationEnd() {
         if (m_fEndCallback) {
             m_fEndCallback(this);
@@ -35,6 +35,13 @@ void CBezierCurve::setup(std::vector<Vector2D>* pVec) {
                ELAPSEDCALCAVG);
 }
 
+bool CBezierCurve::hasPoints(const std::vector<Vector2D>& points) {
+    if (m_dPoints.size() != points.size() + 2)
+        return false;
+
+    return std::equal(points.begin(), points.end(), m_dPoints.begin() + 1);
+}
+
 float CBezierCurve::getYForT(float t) {
     return 3 * t * pow(1 - t, 2) * m_dPoints[1].y + 3 * pow(t, 2) * (1 - t) * m_dPoints[2].y + pow(t, 3);
 }
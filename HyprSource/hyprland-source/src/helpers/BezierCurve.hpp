@@ -15,6 +15,9 @@ class CBezierCurve {
     // this EXCLUDES the 0,0 and 1,1 points,
     void  setup(std::vector<Vector2D>* points);
 
+    // whether setup() was called with these points
+    bool  hasPoints(const std::vector<Vector2D>& points);
+
     float getYForT(float t);
     float getXForT(float t);
     float getYForPoint(float x);
@@ -0,0 +1,109 @@
+#include "DispatcherArgs.hpp"
+#include "MiscFunctions.hpp"
+#include "../debug/Log.hpp"
+
+SWindowSelector parseWindowSelector(const std::string& regexp) {
+    SWindowSelector selector;
+
+    if (regexp.find("title:") == 0) {
+        selector.mode  = MODE_TITLE_REGEX;
+        selector.regex = std::regex(regexp.substr(6));
+    } else if (regexp.find("address:") == 0) {
+        selector.mode  = MODE_ADDRESS;
+        selector.match = regexp.substr(8);
+    } else if (regexp.find("pid:") == 0) {
+        selector.mode  = MODE_PID;
+        selector.match = regexp.substr(4);
+    } else
+        selector.regex = std::regex(regexp);
+
+    return selector;
+}
+
+SWindowVector parseWindowVector(const std::string& args) {
+    SWindowVector vec;
+
+    if (!args.contains(' '))
+        return vec;
+
+    std::string x = args.substr(0, args.find_first_of(' '));
+    std::string y = args.substr(args.find_first_of(' ') + 1);
+
+    if (x == "exact") {
+        std::string newX = y.substr(0, y.find_first_of(' '));
+        std::string newY = y.substr(y.find_first_of(' ') + 1);
+
+        if (!isNumber(newX) || !isNumber(newY)) {
+            Debug::log(ERR, "parseWindowVector: exact args not numbers");
+            return vec;
+        }
+
+        const int X = std::stoi(newX);
+        const int Y = std::stoi(newY);
+
+        if (X < 0 || Y < 0) {
+            Debug::log(ERR, "parseWindowVector: exact args cannot be < 0");
+            return vec;
+        }
+
+        vec.value = Vector2D(X, Y);
+        vec.exact = true;
+        vec.valid = true;
+        return vec;
+    }
+
+    if (!isNumber(x) || !isNumber(y)) {
+        Debug::log(ERR, "parseWindowVector: args not numbers");
+        return vec;
+    }
+
+    vec.value = Vector2D(std::stoi(x), std::stoi(y));
+    vec.valid = true;
+    return vec;
+}
+
+SWindowVectorSelector parseWindowVectorSelector(const std::string& args) {
+    return {parseWindowVector(args.substr(0, args.find_first_of(','))), parseWindowSelector(args.substr(args.find_first_of(',') + 1))};
+}
+
+SSplitRatio parseSplitRatio(const std::string& args) {
+    SSplitRatio ratio;
+
+    if (args == "+" || args == "-") {
+        Debug::log(LOG, "alterSplitRatio: using LEGACY +/-, consider switching to the Hyprland syntax.");
+        ratio.ratio = (args == "+" ? 0.05f : -0.05f);
+    }
+
+    if (ratio.ratio == 0) {
+        if (args.find("exact") == 0) {
+            ratio.exact = true;
+            ratio.ratio = getPlusMinusKeywordResult(args.substr(5), 0);
+        } else {
+            ratio.ratio = getPlusMinusKeywordResult(args, 0);
+        }
+    }
+
+    if (ratio.ratio == INT_MAX) {
+        Debug::log(ERR, "Splitratio invalid in alterSplitRatio!");
+        return ratio;
+    }
+
+    ratio.valid = true;
+    return ratio;
+}
+
+SDirection parseDirection(const std::string& args) {
+    if (!isDirection(args)) {
+        Debug::log(ERR, "Cannot move focus in direction %c, unsupported direction. Supported: l,r,u/t,d/b", args[0]);
+        return {};
+    }
+
+    return {args[0]};
+}
+
+Vector2D applyWindowVector(const SWindowVector& vec, const Vector2D& relativeTo) {
+    if (!vec.valid)
+        return relativeTo;
+
+    return vec.exact ? vec.value : vec.value + relativeTo;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../defines.hpp"
+#include <regex>
+#include <variant>
+
+enum eFocusWindowMode
+{
+    MODE_CLASS_REGEX = 0,
+    MODE_TITLE_REGEX,
+    MODE_ADDRESS,
+    MODE_PID
+};
+
+// a window as given to focuswindow, pass etc.: class regex, title:regex, address:0x... or pid:123
+struct SWindowSelector {
+    eFocusWindowMode mode = MODE_CLASS_REGEX;
+    std::regex       regex;
+    std::string      match = ""; // address or pid
+};
+
+// "x y" relative to the window, or "exact x y"
+struct SWindowVector {
+    Vector2D value;
+    bool     exact = false;
+    bool     valid = false;
+};
+
+// "x y,window" for movewindowpixel and resizewindowpixel
+struct SWindowVectorSelector {
+    SWindowVector   vector;
+    SWindowSelector window;
+};
+
+struct SSplitRatio {
+    float ratio = 0;
+    bool  exact = false;
+    bool  valid = false;
+};
+
+struct SDirection {
+    char direction = 0; // 0 if invalid
+};
+
+// a dispatcher argument parsed once when the bind is added, monostate if the dispatcher only takes strings
+typedef std::variant<std::monostate, SWindowSelector, SWindowVector, SWindowVectorSelector, SSplitRatio, SDirection> DISPATCHER_ARG;
+
+// parsing logs errors and returns an invalid value, applying an invalid value is a no-op
+SWindowSelector       parseWindowSelector(const std::string&);
+SWindowVector         parseWindowVector(const std::string&);
+SWindowVectorSelector parseWindowVectorSelector(const std::string&);
+SSplitRatio           parseSplitRatio(const std::string&);
+SDirection            parseDirection(const std::string&);
+
+Vector2D              applyWindowVector(const SWindowVector&, const Vector2D& relativeTo);
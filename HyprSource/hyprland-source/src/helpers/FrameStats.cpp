@@ -0,0 +1,150 @@
+#include "FrameStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+static uint64_t toNs(const timespec& ts) {
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+CHistogram::CHistogram(float bucketWidth, size_t buckets) : m_vBuckets(buckets + 1, 0), m_fBucketWidth(bucketWidth) {
+    ;
+}
+
+void CHistogram::record(float value) {
+    if (value < 0 || std::isnan(value))
+        return;
+
+    const size_t BUCKET = std::min((size_t)(value / m_fBucketWidth), m_vBuckets.size() - 1);
+    m_vBuckets[BUCKET]++;
+
+    m_iCount++;
+    m_fSum += value;
+    m_fMax = std::max(m_fMax, value);
+}
+
+void CHistogram::reset() {
+    std::fill(m_vBuckets.begin(), m_vBuckets.end(), 0);
+    m_iCount = 0;
+    m_fSum   = 0;
+    m_fMax   = 0;
+}
+
+float CHistogram::percentile(float p) const {
+    if (m_iCount == 0)
+        return 0;
+
+    const uint64_t TARGET = std::max<uint64_t>(1, std::ceil(p * m_iCount));
+    uint64_t       seen   = 0;
+
+    for (size_t i = 0; i < m_vBuckets.size() - 1; ++i) {
+        seen += m_vBuckets[i];
+        if (seen >= TARGET)
+            return std::min((i + 1) * m_fBucketWidth, m_fMax);
+    }
+
+    // in the overflow bucket, the max is the best we know
+    return m_fMax;
+}
+
+float CHistogram::average() const {
+    return m_iCount == 0 ? 0 : m_fSum / m_iCount;
+}
+
+float CHistogram::max() const {
+    return m_fMax;
+}
+
+uint64_t CHistogram::count() const {
+    return m_iCount;
+}
+
+void SFrameStats::onRender(float renderMs, float damagePercent) {
+    frames++;
+    renderTime.record(renderMs);
+    damage.record(damagePercent);
+}
+
+void SFrameStats::onDamage(const SInputMarker& latestInput) {
+    if (latestInput.serial <= m_iLastInputSerial)
+        return;
+
+    m_iLastInputSerial = latestInput.serial;
+
+    // keep the oldest input the next frame answers
+    if (m_iPendingInputTime == 0)
+        m_iPendingInputTime = latestInput.time;
+}
+
+void SFrameStats::onCommit(uint32_t commitSeq) {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    m_aPendingCommits[commitSeq % m_aPendingCommits.size()] = {commitSeq, toNs(now), m_iPendingInputTime};
+    m_iPendingInputTime                                     = 0;
+}
+
+void SFrameStats::onPresent(uint32_t commitSeq, bool wasPresented, const timespec* when, int refreshNs, float fallbackRefreshRate) {
+    // commits are recorded with the seq after the commit. drm reports that one, other backends
+    // capture it while committing, before wlroots bumps it, so try one ahead as well
+    auto* pending = &m_aPendingCommits[commitSeq % m_aPendingCommits.size()];
+    if (pending->seq != commitSeq || pending->time == 0)
+        pending = &m_aPendingCommits[(commitSeq + 1) % m_aPendingCommits.size()];
+
+    const bool MATCHED    = pending->seq == commitSeq || pending->seq == commitSeq + 1;
+    const auto COMMITTIME = MATCHED ? pending->time : 0;
+    const auto INPUTTIME  = MATCHED && pending->time != 0 ? pending->inputTime : 0;
+    pending->time         = 0;
+
+    if (!wasPresented) {
+        discarded++;
+
+        // the input is answered by whatever frame makes it to the screen next
+        if (m_iPendingInputTime == 0)
+            m_iPendingInputTime = INPUTTIME;
+
+        return;
+    }
+
+    presented++;
+
+    if (!when)
+        return;
+
+    const auto PRESENTTIME = toNs(*when);
+
+    if (m_iLastPresent != 0 && PRESENTTIME > m_iLastPresent)
+        frameInterval.record((PRESENTTIME - m_iLastPresent) / 1000000.f);
+
+    m_iLastPresent = PRESENTTIME;
+
+    if (INPUTTIME != 0 && PRESENTTIME >= INPUTTIME && PRESENTTIME - INPUTTIME < 1000000000ULL)
+        inputLatency.record((PRESENTTIME - INPUTTIME) / 1000000.f);
+
+    // the presentation clock is CLOCK_MONOTONIC on every backend we care about, anything past a second is a different clock
+    if (COMMITTIME == 0 || PRESENTTIME < COMMITTIME || PRESENTTIME - COMMITTIME > 1000000000ULL)
+        return;
+
+    const float LATENCYMS = (PRESENTTIME - COMMITTIME) / 1000000.f;
+    presentationLatency.record(LATENCYMS);
+
+    // a frame committed right after a vblank is on screen by the next one, everything later than that missed vblanks
+    const float REFRESHMS = refreshNs > 0 ? refreshNs / 1000000.f : 1000.f / fallbackRefreshRate;
+    if (REFRESHMS > 0 && LATENCYMS > REFRESHMS)
+        missedVblanks += (uint64_t)(LATENCYMS / REFRESHMS);
+}
+
+void SFrameStats::reset() {
+    renderTime.reset();
+    frameInterval.reset();
+    presentationLatency.reset();
+    damage.reset();
+    inputLatency.reset();
+
+    frames              = 0;
+    presented           = 0;
+    discarded           = 0;
+    missedVblanks       = 0;
+    m_iLastPresent      = 0;
+    m_iPendingInputTime = 0;
+}
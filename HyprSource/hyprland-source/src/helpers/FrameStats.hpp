@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+// fixed width buckets with an overflow bucket, recording is a single increment.
+// percentiles are reported as the upper edge of the bucket they fall into.
+class CHistogram {
+  public:
+    CHistogram(float bucketWidth, size_t buckets);
+
+    void     record(float value);
+    void     reset();
+
+    float    percentile(float p) const; // p in [0, 1]
+    float    average() const;
+    float    max() const;
+    uint64_t count() const;
+
+  private:
+    std::vector<uint32_t> m_vBuckets; // last one is everything above the range
+    float                 m_fBucketWidth = 1;
+    uint64_t              m_iCount       = 0;
+    double                m_fSum         = 0;
+    float                 m_fMax         = 0;
+};
+
+// an input event as the frame telemetry sees it
+struct SInputMarker {
+    uint64_t serial = 0; // 0 before the first input event
+    uint64_t time   = 0; // CLOCK_MONOTONIC ns of the device timestamp
+};
+
+// always on per monitor frame telemetry, see hyprctl frametimes
+struct SFrameStats {
+    CHistogram renderTime{0.05f, 1000};          // ms, CPU time of renderMonitor
+    CHistogram frameInterval{0.1f, 1000};        // ms between presented frames
+    CHistogram presentationLatency{0.05f, 1000}; // ms from our commit to the frame turning into light
+    CHistogram damage{1.f, 100};                 // % of the monitor repainted per frame
+    CHistogram inputLatency{0.1f, 1000};         // ms from an input event to the first frame damaged after it turning into light
+
+    uint64_t   frames        = 0;
+    uint64_t   presented     = 0;
+    uint64_t   discarded     = 0; // committed but never shown
+    uint64_t   missedVblanks = 0; // refresh cycles a frame arrived late by
+
+    void       onRender(float renderMs, float damagePercent);
+    void       onDamage(const SInputMarker& latestInput);
+    void       onCommit(uint32_t commitSeq);
+    void       onPresent(uint32_t commitSeq, bool presented, const timespec* when, int refreshNs, float fallbackRefreshRate);
+    void       reset();
+
+  private:
+    struct SPendingCommit {
+        uint32_t seq       = 0;
+        uint64_t time      = 0; // CLOCK_MONOTONIC ns, 0 if unused
+        uint64_t inputTime = 0; // CLOCK_MONOTONIC ns of the input this frame answers, 0 if none
+    };
+
+    std::array<SPendingCommit, 4> m_aPendingCommits;
+    uint64_t                      m_iLastPresent      = 0;
+    uint64_t                      m_iLastInputSerial  = 0;
+    uint64_t                      m_iPendingInputTime = 0;
+};
@@ -0,0 +1,170 @@
+#include "JSONWriter.hpp"
+
+#include <charconv>
+
+CJSONWriter::CJSONWriter(std::string& out) : m_szOut(out) {
+    ;
+}
+
+void CJSONWriter::newline() {
+    m_szOut += '\n';
+    m_szOut.append(m_iDepth * 4, ' ');
+}
+
+void CJSONWriter::beforeValue() {
+    if (m_bAfterKey) {
+        m_bAfterKey = false;
+        return;
+    }
+
+    if (m_iDepth == 0)
+        return;
+
+    auto& scope = m_aScopes[m_iDepth - 1];
+
+    if (!scope.empty)
+        m_szOut += scope.inlined ? ", " : ",";
+
+    if (!scope.inlined)
+        newline();
+
+    scope.empty = false;
+}
+
+CJSONWriter& CJSONWriter::beginObject() {
+    beforeValue();
+
+    m_szOut += '{';
+    m_aScopes[m_iDepth++] = {false, true};
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::endObject() {
+    const auto SCOPE = m_aScopes[--m_iDepth];
+
+    if (!SCOPE.empty)
+        newline();
+
+    m_szOut += '}';
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::beginArray(bool inlined) {
+    beforeValue();
+
+    m_szOut += '[';
+    m_aScopes[m_iDepth++] = {inlined, true};
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::endArray() {
+    const auto SCOPE = m_aScopes[--m_iDepth];
+
+    if (!SCOPE.empty && !SCOPE.inlined)
+        newline();
+
+    m_szOut += ']';
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::key(std::string_view name) {
+    beforeValue();
+
+    m_szOut += '"';
+    appendEscaped(name);
+    m_szOut += "\": ";
+
+    m_bAfterKey = true;
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::string(std::string_view value) {
+    beforeValue();
+
+    m_szOut += '"';
+    appendEscaped(value);
+    m_szOut += '"';
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::integer(int64_t value) {
+    beforeValue();
+
+    char       buf[24];
+    const auto RESULT = std::to_chars(buf, buf + sizeof(buf), value);
+    m_szOut.append(buf, RESULT.ptr);
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::number(double value, int precision) {
+    beforeValue();
+
+    char       buf[64];
+    const auto RESULT = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::fixed, precision);
+
+    if (RESULT.ec != std::errc())
+        m_szOut += '0';
+    else
+        m_szOut.append(buf, RESULT.ptr);
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::boolean(bool value) {
+    beforeValue();
+
+    m_szOut += value ? "true" : "false";
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::null() {
+    beforeValue();
+
+    m_szOut += "null";
+
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::address(const void* value) {
+    beforeValue();
+
+    char       buf[16];
+    const auto RESULT = std::to_chars(buf, buf + sizeof(buf), (uint32_t)(uintptr_t)value, 16);
+
+    m_szOut += "\"0x";
+    m_szOut.append(buf, RESULT.ptr);
+    m_szOut += '"';
+
+    return *this;
+}
+
+void CJSONWriter::appendEscaped(std::string_view value) {
+    constexpr const char* HEX = "0123456789abcdef";
+
+    for (const char c : value) {
+        switch (c) {
+            case '"': m_szOut += "\\\""; break;
+            case '\\': m_szOut += "\\\\"; break;
+            case '\b': m_szOut += "\\b"; break;
+            case '\f': m_szOut += "\\f"; break;
+            case '\n': m_szOut += "\\n"; break;
+            case '\r': m_szOut += "\\r"; break;
+            case '\t': m_szOut += "\\t"; break;
+            default:
+                if ('\x00' <= c && c <= '\x1f') {
+                    m_szOut += "\\u00";
+                    m_szOut += HEX[c >> 4];
+                    m_szOut += HEX[c & 0xF];
+                } else
+                    m_szOut += c;
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// appends pretty-printed JSON straight into a caller-owned buffer, escaping as it goes.
+// takes care of commas and indentation, so callers never trim anything.
+class CJSONWriter {
+  public:
+    CJSONWriter(std::string& out);
+
+    CJSONWriter& beginObject();
+    CJSONWriter& endObject();
+
+    // inlined arrays keep their elements on one line, e.g. "at": [0, 0]
+    CJSONWriter& beginArray(bool inlined = false);
+    CJSONWriter& endArray();
+
+    CJSONWriter& key(std::string_view name);
+
+    CJSONWriter& string(std::string_view value);
+    CJSONWriter& integer(int64_t value);
+    CJSONWriter& number(double value, int precision = 6);
+    CJSONWriter& boolean(bool value);
+    CJSONWriter& null();
+
+    // "0x%x" like everywhere else in hyprctl, so addresses can be fed back into dispatchers
+    CJSONWriter& address(const void* value);
+
+  private:
+    struct SScope {
+        bool inlined = false;
+        bool empty   = true;
+    };
+
+    void                   beforeValue();
+    void                   newline();
+    void                   appendEscaped(std::string_view value);
+
+    std::string&           m_szOut;
+
+    std::array<SScope, 16> m_aScopes;
+    size_t                 m_iDepth    = 0;
+    bool                   m_bAfterKey = false;
+};
@@ -22,11 +22,13 @@ void CMonitor::onConnect(bool noRule) {
     hyprListener_monitorStateRequest.removeCallback();
     hyprListener_monitorDamage.removeCallback();
     hyprListener_monitorNeedsFrame.removeCallback();
+    hyprListener_monitorPresent.removeCallback();
     hyprListener_monitorFrame.initCallback(&output->events.frame, &Events::listener_monitorFrame, this);
     hyprListener_monitorDestroy.initCallback(&output->events.destroy, &Events::listener_monitorDestroy, this);
     hyprListener_monitorStateRequest.initCallback(&output->events.request_state, &Events::listener_monitorStateRequest, this);
     hyprListener_monitorDamage.initCallback(&output->events.damage, &Events::listener_monitorDamage, this);
     hyprListener_monitorNeedsFrame.initCallback(&output->events.needs_frame, &Events::listener_monitorNeedsFrame, this);
+    hyprListener_monitorPresent.initCallback(&output->events.present, &Events::listener_monitorPresent, this);
 
     if (m_bEnabled) {
         wlr_output_enable(output, 1);
@@ -221,6 +223,7 @@ void CMonitor::onDisconnect() {
     hyprListener_monitorFrame.removeCallback();
     hyprListener_monitorDamage.removeCallback();
     hyprListener_monitorNeedsFrame.removeCallback();
+    hyprListener_monitorPresent.removeCallback();
 
     for (size_t i = 0; i < 4; ++i) {
         for (auto& ls : m_aLayerSurfaceLayers[i]) {
@@ -296,13 +299,17 @@ void CMonitor::onDisconnect() {
 }
 
 void CMonitor::addDamage(const pixman_region32_t* rg) {
-    if (wlr_damage_ring_add(&damage, rg))
+    if (wlr_damage_ring_add(&damage, rg)) {
+        frameStats.onDamage(g_pInputManager->m_sLatestInput);
         g_pCompositor->scheduleFrameForMonitor(this);
+    }
 }
 
 void CMonitor::addDamage(const wlr_box* box) {
-    if (wlr_damage_ring_add_box(&damage, box))
+    if (wlr_damage_ring_add_box(&damage, box)) {
+        frameStats.onDamage(g_pInputManager->m_sLatestInput);
         g_pCompositor->scheduleFrameForMonitor(this);
+    }
 }
 
 bool CMonitor::isMirror() {
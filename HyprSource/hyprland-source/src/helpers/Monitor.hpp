@@ -7,6 +7,7 @@
 #include <array>
 #include <memory>
 #include "Timer.hpp"
+#include "FrameStats.hpp"
 
 struct SMonitorRule;
 
@@ -52,6 +53,7 @@ class CMonitor {
     wl_event_source*    renderTimer  = nullptr; // for RAT
     bool                RATScheduled = false;
     CTimer              lastPresentationTimer;
+    SFrameStats         frameStats;
 
     // mirroring
     CMonitor*              pMirrorOf = nullptr;
@@ -67,6 +69,7 @@ class CMonitor {
     DYNLISTENER(monitorStateRequest);
     DYNLISTENER(monitorDamage);
     DYNLISTENER(monitorNeedsFrame);
+    DYNLISTENER(monitorPresent);
 
     // hack: a group = workspaces on a monitor.
     // I don't really care lol :P
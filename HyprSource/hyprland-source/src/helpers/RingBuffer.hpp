@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// bounded lock-free multi-producer multi-consumer queue.
+// every cell carries a sequence number telling producers and consumers whose turn it is,
+// so push and pop only ever CAS their own position counter.
+template <typename T, size_t SIZE>
+class CRingBuffer {
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "CRingBuffer size has to be a power of two");
+
+  public:
+    CRingBuffer() {
+        for (size_t i = 0; i < SIZE; ++i)
+            m_aCells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // returns false if the queue is full
+    bool push(T&& value) {
+        SCell* cell = nullptr;
+        size_t pos  = m_iEnqueuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell                = &m_aCells[pos & (SIZE - 1)];
+            const auto     SEQ  = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t DIFF = (intptr_t)SEQ - (intptr_t)pos;
+
+            if (DIFF == 0) {
+                if (m_iEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (DIFF < 0)
+                return false;
+            else
+                pos = m_iEnqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // returns false if the queue is empty
+    bool pop(T& out) {
+        SCell* cell = nullptr;
+        size_t pos  = m_iDequeuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell                = &m_aCells[pos & (SIZE - 1)];
+            const auto     SEQ  = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t DIFF = (intptr_t)SEQ - (intptr_t)(pos + 1);
+
+            if (DIFF == 0) {
+                if (m_iDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (DIFF < 0)
+                return false;
+            else
+                pos = m_iDequeuePos.load(std::memory_order_relaxed);
+        }
+
+        out = std::move(cell->value);
+        cell->sequence.store(pos + SIZE, std::memory_order_release);
+
+        return true;
+    }
+
+  private:
+    struct SCell {
+        std::atomic<size_t> sequence;
+        T                   value;
+    };
+
+    std::array<SCell, SIZE>          m_aCells;
+
+    alignas(64) std::atomic<size_t> m_iEnqueuePos = 0;
+    alignas(64) std::atomic<size_t> m_iDequeuePos = 0;
+};
@@ -11,6 +11,8 @@
 struct SLayerRule {
     std::string targetNamespace = "";
     std::string rule            = "";
+
+    bool        operator==(const SLayerRule&) const = default;
 };
 
 struct SLayerSurface {
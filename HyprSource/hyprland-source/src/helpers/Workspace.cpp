@@ -1,7 +1,7 @@
 #include "Workspace.hpp"
 #include "../Compositor.hpp"
 
-CWorkspace::CWorkspace(int monitorID, std::string name, bool special) {
+CWorkspace::CWorkspace(int monitorID, std::string name, bool special, bool mock) {
     const auto PMONITOR = g_pCompositor->getMonitorFromID(monitorID);
 
     if (!PMONITOR) {
@@ -12,8 +12,9 @@ CWorkspace::CWorkspace(int monitorID, std::string name, bool special) {
     m_iMonitorID          = monitorID;
     m_szName              = name;
     m_bIsSpecialWorkspace = special;
+    m_bIsMock             = mock;
 
-    if (!special) {
+    if (!special && !mock) {
         m_pWlrHandle = wlr_ext_workspace_handle_v1_create(PMONITOR->pWLRWorkspaceGroupHandle);
 
         // set geometry here cuz we can
@@ -36,7 +37,10 @@ CWorkspace::CWorkspace(int monitorID, std::string name, bool special) {
     m_vRenderOffset.registerVar();
     m_fAlpha.registerVar();
 
-    g_pEventManager->postEvent({"createworkspace", m_szName}, true);
+    if (mock)
+        return;
+
+    g_pEventManager->postEvent({"createworkspace", m_szName, "", m_szName}, true);
     EMIT_HOOK_EVENT("createWorkspace", this);
 }
 
@@ -51,7 +55,10 @@ CWorkspace::~CWorkspace() {
         m_pWlrHandle = nullptr;
     }
 
-    g_pEventManager->postEvent({"destroyworkspace", m_szName}, true);
+    if (m_bIsMock)
+        return;
+
+    g_pEventManager->postEvent({"destroyworkspace", m_szName, "", m_szName}, true);
     EMIT_HOOK_EVENT("destroyWorkspace", this);
 }
 
@@ -13,7 +13,8 @@ class CWindow;
 
 class CWorkspace {
   public:
-    CWorkspace(int monitorID, std::string name, bool special = false);
+    // mock workspaces get no ext-workspace handle and post no events, for hyprctl layoutbench
+    CWorkspace(int monitorID, std::string name, bool special = false, bool mock = false);
     ~CWorkspace();
 
     // Workspaces ID-based have IDs > 0
@@ -43,6 +44,8 @@ class CWorkspace {
     // "scratchpad"
     bool m_bIsSpecialWorkspace = false;
 
+    bool m_bIsMock = false;
+
     // last window
     CWindow* m_pLastFocusedWindow = nullptr;
 
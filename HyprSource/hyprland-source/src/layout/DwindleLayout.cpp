@@ -6,8 +6,8 @@ void SDwindleNodeData::recalcSizePosRecursive(bool force) {
 
         const auto         REVERSESPLITRATIO = 2.f - splitRatio;
 
-        static auto* const PPRESERVESPLIT = &g_pConfigManager->getConfigValuePtr("dwindle:preserve_split")->intValue;
-        static auto* const PFLMULT        = &g_pConfigManager->getConfigValuePtr("dwindle:split_width_multiplier")->floatValue;
+        static auto* const PPRESERVESPLIT = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_PRESERVE_SPLIT)->intValue;
+        static auto* const PFLMULT        = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_SPLIT_WIDTH_MULTIPLIER)->floatValue;
 
         if (*PPRESERVESPLIT == 0) {
             splitTop = size.y * *PFLMULT > size.x;
@@ -108,9 +108,9 @@ void CHyprDwindleLayout::applyNodeDataToWindow(SDwindleNodeData* pNode, bool for
     const bool DISPLAYTOP    = STICKS(pNode->position.y, PMONITOR->vecPosition.y + PMONITOR->vecReservedTopLeft.y);
     const bool DISPLAYBOTTOM = STICKS(pNode->position.y + pNode->size.y, PMONITOR->vecPosition.y + PMONITOR->vecSize.y - PMONITOR->vecReservedBottomRight.y);
 
-    const auto PBORDERSIZE = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
-    const auto PGAPSIN     = &g_pConfigManager->getConfigValuePtr("general:gaps_in")->intValue;
-    const auto PGAPSOUT    = &g_pConfigManager->getConfigValuePtr("general:gaps_out")->intValue;
+    const auto PBORDERSIZE = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
+    const auto PGAPSIN     = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_GAPS_IN)->intValue;
+    const auto PGAPSOUT    = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_GAPS_OUT)->intValue;
 
     const auto PWINDOW = pNode->pWindow;
 
@@ -123,7 +123,7 @@ void CHyprDwindleLayout::applyNodeDataToWindow(SDwindleNodeData* pNode, bool for
     PWINDOW->m_vSize     = pNode->size;
     PWINDOW->m_vPosition = pNode->position;
 
-    static auto* const PNOGAPSWHENONLY = &g_pConfigManager->getConfigValuePtr("dwindle:no_gaps_when_only")->intValue;
+    static auto* const PNOGAPSWHENONLY = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_NO_GAPS_WHEN_ONLY)->intValue;
 
     auto               calcPos  = PWINDOW->m_vPosition + Vector2D(*PBORDERSIZE, *PBORDERSIZE);
     auto               calcSize = PWINDOW->m_vSize - Vector2D(2 * *PBORDERSIZE, 2 * *PBORDERSIZE);
@@ -185,7 +185,7 @@ void CHyprDwindleLayout::applyNodeDataToWindow(SDwindleNodeData* pNode, bool for
 
     if (g_pCompositor->isWorkspaceSpecial(PWINDOW->m_iWorkspaceID)) {
         // if special, we adjust the coords a bit
-        static auto* const PSCALEFACTOR = &g_pConfigManager->getConfigValuePtr("dwindle:special_scale_factor")->floatValue;
+        static auto* const PSCALEFACTOR = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_SPECIAL_SCALE_FACTOR)->floatValue;
 
         PWINDOW->m_vRealPosition = calcPos + (calcSize - calcSize * *PSCALEFACTOR) / 2.f;
         PWINDOW->m_vRealSize     = calcSize * *PSCALEFACTOR;
@@ -219,8 +219,8 @@ void CHyprDwindleLayout::onWindowCreatedTiling(CWindow* pWindow) {
 
     const auto         PMONITOR = g_pCompositor->getMonitorFromID(pWindow->m_iMonitorID);
 
-    static auto* const PUSEACTIVE    = &g_pConfigManager->getConfigValuePtr("dwindle:use_active_for_splits")->intValue;
-    static auto* const PDEFAULTSPLIT = &g_pConfigManager->getConfigValuePtr("dwindle:default_split_ratio")->floatValue;
+    static auto* const PUSEACTIVE    = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_USE_ACTIVE_FOR_SPLITS)->intValue;
+    static auto* const PDEFAULTSPLIT = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_DEFAULT_SPLIT_RATIO)->floatValue;
 
     // Populate the node with our window's data
     PNODE->workspaceID = pWindow->m_iWorkspaceID;
@@ -320,7 +320,7 @@ void CHyprDwindleLayout::onWindowCreatedTiling(CWindow* pWindow) {
     NEWPARENT->isNode      = true; // it is a node
     NEWPARENT->splitRatio  = std::clamp(*PDEFAULTSPLIT, 0.1f, 1.9f);
 
-    const auto PWIDTHMULTIPLIER = &g_pConfigManager->getConfigValuePtr("dwindle:split_width_multiplier")->floatValue;
+    const auto PWIDTHMULTIPLIER = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_SPLIT_WIDTH_MULTIPLIER)->floatValue;
 
     // if cursor over first child, make it first, etc
     const auto SIDEBYSIDE = NEWPARENT->size.x > NEWPARENT->size.y * *PWIDTHMULTIPLIER;
@@ -328,7 +328,7 @@ void CHyprDwindleLayout::onWindowCreatedTiling(CWindow* pWindow) {
 
     const auto MOUSECOORDS = g_pInputManager->getMouseCoordsInternal();
 
-    const auto PFORCESPLIT = &g_pConfigManager->getConfigValuePtr("dwindle:force_split")->intValue;
+    const auto PFORCESPLIT = &g_pConfigManager->getConfigValuePtr(CFG_DWINDLE_FORCE_SPLIT)->intValue;
 
     if (*PFORCESPLIT == 0) {
         if ((SIDEBYSIDE &&
@@ -440,6 +440,11 @@ void CHyprDwindleLayout::onWindowRemovedTiling(CWindow* pWindow) {
 }
 
 void CHyprDwindleLayout::recalculateMonitor(const int& monid) {
+    if (g_pCompositor->deferMonitorRecalculation(monid))
+        return;
+
+    TRACE_SCOPE("layout", "recalculateMonitor");
+
     const auto PMONITOR = g_pCompositor->getMonitorFromID(monid);
 
     if (!PMONITOR)
@@ -512,7 +517,7 @@ void CHyprDwindleLayout::resizeActiveWindow(const Vector2D& pixResize, CWindow*
         return;
     }
 
-    const auto PANIMATE = &g_pConfigManager->getConfigValuePtr("misc:animate_manual_resizes")->intValue;
+    const auto PANIMATE = &g_pConfigManager->getConfigValuePtr(CFG_MISC_ANIMATE_MANUAL_RESIZES)->intValue;
 
     // get some data about our window
     const auto PMONITOR      = g_pCompositor->getMonitorFromID(PWINDOW->m_iMonitorID);
@@ -607,7 +612,7 @@ void CHyprDwindleLayout::fullscreenRequestForWindow(CWindow* pWindow, eFullscree
     pWindow->m_bIsFullscreen           = on;
     PWORKSPACE->m_bHasFullscreenWindow = !PWORKSPACE->m_bHasFullscreenWindow;
 
-    g_pEventManager->postEvent(SHyprIPCEvent{"fullscreen", std::to_string((int)on)});
+    g_pEventManager->postEvent(windowIPCEvent("fullscreen", std::to_string((int)on), pWindow));
     EMIT_HOOK_EVENT("fullscreen", pWindow);
 
     if (!pWindow->m_bIsFullscreen) {
@@ -274,8 +274,8 @@ void IHyprLayout::onMouseMove(const Vector2D& mousePos) {
     const auto  DELTA     = Vector2D(mousePos.x - m_vBeginDragXY.x, mousePos.y - m_vBeginDragXY.y);
     const auto  TICKDELTA = Vector2D(mousePos.x - m_vLastDragXY.x, mousePos.y - m_vLastDragXY.y);
 
-    const auto  PANIMATEMOUSE = &g_pConfigManager->getConfigValuePtr("misc:animate_mouse_windowdragging")->intValue;
-    const auto  PANIMATE      = &g_pConfigManager->getConfigValuePtr("misc:animate_manual_resizes")->intValue;
+    const auto  PANIMATEMOUSE = &g_pConfigManager->getConfigValuePtr(CFG_MISC_ANIMATE_MOUSE_WINDOWDRAGGING)->intValue;
+    const auto  PANIMATE      = &g_pConfigManager->getConfigValuePtr(CFG_MISC_ANIMATE_MANUAL_RESIZES)->intValue;
 
     if ((abs(TICKDELTA.x) < 1.f && abs(TICKDELTA.y) < 1.f) ||
         (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - TIMER).count() <
@@ -368,7 +368,7 @@ void IHyprLayout::changeWindowFloatingMode(CWindow* pWindow) {
     const auto TILED = isWindowTiled(pWindow);
 
     // event
-    g_pEventManager->postEvent(SHyprIPCEvent{"changefloatingmode", getFormat("%x,%d", pWindow, (int)TILED)});
+    g_pEventManager->postEvent(windowIPCEvent("changefloatingmode", getFormat("%x,%d", pWindow, (int)TILED), pWindow));
     EMIT_HOOK_EVENT("changeFloatingMode", pWindow);
 
     if (!TILED) {
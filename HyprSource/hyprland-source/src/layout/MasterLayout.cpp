@@ -40,7 +40,7 @@ SMasterWorkspaceData* CHyprMasterLayout::getMasterWorkspaceData(const int& ws) {
     //create on the fly if it doesn't exist yet
     const auto PWORKSPACEDATA   = &m_lMasterWorkspacesData.emplace_back();
     PWORKSPACEDATA->workspaceID = ws;
-    const auto orientation      = &g_pConfigManager->getConfigValuePtr("master:orientation")->strValue;
+    const auto orientation      = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_ORIENTATION)->strValue;
     if (*orientation == "top") {
         PWORKSPACEDATA->orientation = ORIENTATION_TOP;
     } else if (*orientation == "right") {
@@ -72,7 +72,7 @@ void CHyprMasterLayout::onWindowCreatedTiling(CWindow* pWindow) {
     if (pWindow->m_bIsFloating)
         return;
 
-    static auto* const PNEWTOP = &g_pConfigManager->getConfigValuePtr("master:new_on_top")->intValue;
+    static auto* const PNEWTOP = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_NEW_ON_TOP)->intValue;
 
     const auto         PMONITOR = g_pCompositor->getMonitorFromID(pWindow->m_iMonitorID);
 
@@ -81,10 +81,10 @@ void CHyprMasterLayout::onWindowCreatedTiling(CWindow* pWindow) {
     PNODE->workspaceID = pWindow->m_iWorkspaceID;
     PNODE->pWindow     = pWindow;
 
-    static auto* const PNEWISMASTER = &g_pConfigManager->getConfigValuePtr("master:new_is_master")->intValue;
+    static auto* const PNEWISMASTER = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_NEW_IS_MASTER)->intValue;
 
     const auto         WINDOWSONWORKSPACE = getNodesOnWorkspace(PNODE->workspaceID);
-    static auto* const PMFACT             = &g_pConfigManager->getConfigValuePtr("master:mfact")->floatValue;
+    static auto* const PMFACT             = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_MFACT)->floatValue;
     float              lastSplitPercent   = *PMFACT;
 
     auto               OPENINGON = isWindowTiled(g_pCompositor->m_pLastWindow) && g_pCompositor->m_pLastWindow->m_iWorkspaceID == pWindow->m_iWorkspaceID ?
@@ -190,6 +190,11 @@ void CHyprMasterLayout::onWindowRemovedTiling(CWindow* pWindow) {
 }
 
 void CHyprMasterLayout::recalculateMonitor(const int& monid) {
+    if (g_pCompositor->deferMonitorRecalculation(monid))
+        return;
+
+    TRACE_SCOPE("layout", "recalculateMonitor");
+
     const auto PMONITOR   = g_pCompositor->getMonitorFromID(monid);
     const auto PWORKSPACE = g_pCompositor->getWorkspaceByID(PMONITOR->activeWorkspace);
 
@@ -245,7 +250,7 @@ void CHyprMasterLayout::calculateWorkspace(const int& ws) {
 
     eOrientation       orientation        = PWORKSPACEDATA->orientation;
     bool               centerMasterWindow = false;
-    static auto* const ALWAYSCENTER       = &g_pConfigManager->getConfigValuePtr("master:always_center_master")->intValue;
+    static auto* const ALWAYSCENTER       = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_ALWAYS_CENTER_MASTER)->intValue;
     if (orientation == ORIENTATION_CENTER) {
         if (getNodesOnWorkspace(PWORKSPACE->m_iID) > 2 || (*ALWAYSCENTER == 1)) {
             centerMasterWindow = true;
@@ -463,9 +468,9 @@ void CHyprMasterLayout::applyNodeDataToWindow(SMasterNodeData* pNode) {
     const bool DISPLAYTOP    = STICKS(pNode->position.y, PMONITOR->vecPosition.y + PMONITOR->vecReservedTopLeft.y);
     const bool DISPLAYBOTTOM = STICKS(pNode->position.y + pNode->size.y, PMONITOR->vecPosition.y + PMONITOR->vecSize.y - PMONITOR->vecReservedBottomRight.y);
 
-    const auto PBORDERSIZE = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
-    const auto PGAPSIN     = &g_pConfigManager->getConfigValuePtr("general:gaps_in")->intValue;
-    const auto PGAPSOUT    = &g_pConfigManager->getConfigValuePtr("general:gaps_out")->intValue;
+    const auto PBORDERSIZE = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
+    const auto PGAPSIN     = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_GAPS_IN)->intValue;
+    const auto PGAPSOUT    = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_GAPS_OUT)->intValue;
 
     const auto PWINDOW = pNode->pWindow;
 
@@ -474,7 +479,7 @@ void CHyprMasterLayout::applyNodeDataToWindow(SMasterNodeData* pNode) {
         return;
     }
 
-    static auto* const PNOGAPSWHENONLY = &g_pConfigManager->getConfigValuePtr("master:no_gaps_when_only")->intValue;
+    static auto* const PNOGAPSWHENONLY = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_NO_GAPS_WHEN_ONLY)->intValue;
 
     PWINDOW->m_vSize     = pNode->size;
     PWINDOW->m_vPosition = pNode->position;
@@ -513,7 +518,7 @@ void CHyprMasterLayout::applyNodeDataToWindow(SMasterNodeData* pNode) {
     calcSize            = calcSize - (RESERVED.topLeft + RESERVED.bottomRight);
 
     if (g_pCompositor->isWorkspaceSpecial(PWINDOW->m_iWorkspaceID)) {
-        static auto* const PSCALEFACTOR = &g_pConfigManager->getConfigValuePtr("master:special_scale_factor")->floatValue;
+        static auto* const PSCALEFACTOR = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_SPECIAL_SCALE_FACTOR)->floatValue;
 
         PWINDOW->m_vRealPosition = calcPos + (calcSize - calcSize * *PSCALEFACTOR) / 2.f;
         PWINDOW->m_vRealSize     = calcSize * *PSCALEFACTOR;
@@ -625,7 +630,7 @@ void CHyprMasterLayout::fullscreenRequestForWindow(CWindow* pWindow, eFullscreen
     pWindow->m_bIsFullscreen           = on;
     PWORKSPACE->m_bHasFullscreenWindow = !PWORKSPACE->m_bHasFullscreenWindow;
 
-    g_pEventManager->postEvent(SHyprIPCEvent{"fullscreen", std::to_string((int)on)});
+    g_pEventManager->postEvent(windowIPCEvent("fullscreen", std::to_string((int)on), pWindow));
     EMIT_HOOK_EVENT("fullscreen", pWindow);
 
     if (!pWindow->m_bIsFullscreen) {
@@ -777,7 +782,7 @@ bool CHyprMasterLayout::prepareLoseFocus(CWindow* pWindow) {
     //if the current window is fullscreen, make it normal again if we are about to lose focus
     if (pWindow->m_bIsFullscreen) {
         g_pCompositor->setWindowFullscreen(pWindow, false, FULLSCREEN_FULL);
-        static auto* const INHERIT = &g_pConfigManager->getConfigValuePtr("master:inherit_fullscreen")->intValue;
+        static auto* const INHERIT = &g_pConfigManager->getConfigValuePtr(CFG_MASTER_INHERIT_FULLSCREEN)->intValue;
         return *INHERIT == 1;
     }
 
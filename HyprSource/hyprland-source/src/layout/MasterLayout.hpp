@@ -83,4 +83,5 @@ class CHyprMasterLayout : public IHyprLayout {
 
     friend struct SMasterNodeData;
     friend struct SMasterWorkspaceData;
+    friend class CLayoutManager;
 };
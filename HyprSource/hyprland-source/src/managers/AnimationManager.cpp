@@ -21,6 +21,8 @@ CAnimationManager::CAnimationManager() {
 }
 
 void CAnimationManager::removeAllBeziers() {
+    // keep the baked curves, a config reload will most likely re-add the same ones
+    m_mPreviousBezierCurves = std::move(m_mBezierCurves);
     m_mBezierCurves.clear();
 
     // add the default one
@@ -28,12 +30,25 @@ void CAnimationManager::removeAllBeziers() {
     m_mBezierCurves["default"].setup(&points);
 }
 
+void CAnimationManager::pruneUnusedBeziers() {
+    // whatever the reload did not redeclare is gone for good
+    m_mPreviousBezierCurves.clear();
+}
+
 void CAnimationManager::addBezierWithName(std::string name, const Vector2D& p1, const Vector2D& p2) {
     std::vector points = {p1, p2};
+
+    if (const auto IT = m_mPreviousBezierCurves.find(name); IT != m_mPreviousBezierCurves.end() && IT->second.hasPoints(points)) {
+        m_mBezierCurves[name] = std::move(IT->second);
+        m_mPreviousBezierCurves.erase(IT);
+        return;
+    }
+
     m_mBezierCurves[name].setup(&points);
 }
 
 void CAnimationManager::tick() {
+    TRACE_SCOPE("animation", "tick");
 
     static std::chrono::time_point lastTick = std::chrono::high_resolution_clock::now();
     m_fLastTickTime                         = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - lastTick).count() / 1000.0;
@@ -41,13 +56,13 @@ void CAnimationManager::tick() {
 
     bool               animGlobalDisabled = false;
 
-    static auto* const PANIMENABLED = &g_pConfigManager->getConfigValuePtr("animations:enabled")->intValue;
+    static auto* const PANIMENABLED = &g_pConfigManager->getConfigValuePtr(CFG_ANIMATIONS_ENABLED)->intValue;
 
     if (!*PANIMENABLED)
         animGlobalDisabled = true;
 
-    static auto* const              PBORDERSIZE     = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
-    static auto* const              PSHADOWSENABLED = &g_pConfigManager->getConfigValuePtr("decoration:drop_shadow")->intValue;
+    static auto* const              PBORDERSIZE     = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
+    static auto* const              PSHADOWSENABLED = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DROP_SHADOW)->intValue;
 
     const auto                      DEFAULTBEZIER = m_mBezierCurves.find("default");
 
@@ -201,7 +216,7 @@ void CAnimationManager::tick() {
                 RASSERT(PWINDOW, "Tried to AVARDAMAGE_BORDER a non-window AVAR!");
 
                 // damage only the border.
-                static auto* const PROUNDING    = &g_pConfigManager->getConfigValuePtr("decoration:rounding")->intValue;
+                static auto* const PROUNDING    = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ROUNDING)->intValue;
                 const auto         ROUNDINGSIZE = *PROUNDING + 1;
                 const auto         BORDERSIZE   = *PBORDERSIZE;
 
@@ -226,7 +241,7 @@ void CAnimationManager::tick() {
             case AVARDAMAGE_SHADOW: {
                 RASSERT(PWINDOW, "Tried to AVARDAMAGE_SHADOW a non-window AVAR!");
 
-                static auto* const PSHADOWIGNOREWINDOW = &g_pConfigManager->getConfigValuePtr("decoration:shadow_ignore_window")->intValue;
+                static auto* const PSHADOWIGNOREWINDOW = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_SHADOW_IGNORE_WINDOW)->intValue;
 
                 const auto         PDECO = PWINDOW->getDecorationByType(DECORATION_SHADOW);
 
@@ -497,3 +512,8 @@ CBezierCurve* CAnimationManager::getBezier(const std::string& name) {
 std::unordered_map<std::string, CBezierCurve> CAnimationManager::getAllBeziers() {
     return m_mBezierCurves;
 }
+
+void CAnimationManager::restoreBeziers(std::unordered_map<std::string, CBezierCurve>&& beziers) {
+    m_mBezierCurves = std::move(beziers);
+    m_mPreviousBezierCurves.clear();
+}
@@ -15,6 +15,7 @@ class CAnimationManager {
     void                                          tick();
     void                                          addBezierWithName(std::string, const Vector2D&, const Vector2D&);
     void                                          removeAllBeziers();
+    void                                          pruneUnusedBeziers();
 
     void                                          onWindowPostCreateClose(CWindow*, bool close = false);
 
@@ -24,6 +25,7 @@ class CAnimationManager {
     std::string                                   styleValidInConfigVar(const std::string&, const std::string&);
 
     std::unordered_map<std::string, CBezierCurve> getAllBeziers();
+    void                                          restoreBeziers(std::unordered_map<std::string, CBezierCurve>&&);
 
     std::list<CAnimatedVariable*>                 m_lAnimatedVariables;
 
@@ -40,6 +42,7 @@ class CAnimationManager {
     bool                                          deltazero(const float& a, const float& b);
 
     std::unordered_map<std::string, CBezierCurve> m_mBezierCurves;
+    std::unordered_map<std::string, CBezierCurve> m_mPreviousBezierCurves; // from before removeAllBeziers, reused if unchanged
 
     // Anim stuff
     void animationPopin(CWindow*, bool close = false, float minPerc = 0.f);
@@ -7,114 +7,289 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/un.h>
 #include <unistd.h>
-#include <sys/ioctl.h>
 
 #include <string>
 
+// events hyprland posts itself get a bit each, anything else (e.g. from plugins) shares the last one
+static const std::array<std::string, 20> IPC_EVENT_NAMES = {"workspace", "focusedmon", "activewindow", "activewindowv2", "fullscreen", "monitorremoved", "monitoradded",
+                                                            "createworkspace", "destroyworkspace", "moveworkspace", "activelayout", "openwindow", "closewindow",
+                                                            "movewindow", "openlayer", "closelayer", "submap", "changefloatingmode", "urgent", "minimize"};
+
+#define IPC_OTHER_EVENTS_BIT (1ULL << 63)
+
+static uint64_t eventBit(const std::string& event) {
+    for (size_t i = 0; i < IPC_EVENT_NAMES.size(); ++i) {
+        if (IPC_EVENT_NAMES[i] == event)
+            return 1ULL << i;
+    }
+
+    return IPC_OTHER_EVENTS_BIT;
+}
+
+// what a client may subscribe to, "other" stands for every event without a bit of its own. 0 if unknown
+static uint64_t subscriptionBit(const std::string& name) {
+    if (name == "other")
+        return IPC_OTHER_EVENTS_BIT;
+
+    const auto BIT = eventBit(name);
+
+    return BIT == IPC_OTHER_EVENTS_BIT ? 0 : BIT;
+}
+
+// what a hyprctl query could see differently after the event
+static uint32_t snapshotSections(const std::string& event) {
+    if (event == "activelayout")
+        return SNAPSHOT_DEVICES;
+    if (event == "openlayer" || event == "closelayer")
+        return SNAPSHOT_LAYERS;
+    if (event == "monitoradded" || event == "monitorremoved")
+        return SNAPSHOT_ALL;
+    if (event == "submap")
+        return 0;
+
+    return SNAPSHOT_MONITORS | SNAPSHOT_WINDOWS | SNAPSHOT_WORKSPACES;
+}
+
+SHyprIPCEvent windowIPCEvent(const std::string& event, const std::string& data, CWindow* pWindow) {
+    const auto PMONITOR   = g_pCompositor->getMonitorFromID(pWindow->m_iMonitorID);
+    const auto PWORKSPACE = g_pCompositor->getWorkspaceByID(pWindow->m_iWorkspaceID);
+
+    return SHyprIPCEvent{event, data, PMONITOR ? PMONITOR->szName : "", PWORKSPACE ? PWORKSPACE->m_szName : ""};
+}
+
 CEventManager::CEventManager() {}
 
-int fdHandleWrite(int fd, uint32_t mask, void* data) {
+CEventManager::~CEventManager() {
+    for (auto& c : m_lClients)
+        close(c.fd);
+
+    if (m_iSocketFD >= 0)
+        close(m_iSocketFD);
+
+    if (m_iWakeFD >= 0)
+        close(m_iWakeFD);
+}
+
+void CEventManager::removeClient(SSocket2Client* client) {
+    wl_event_source_remove(client->source);
+    close(client->fd);
+
+    m_lClients.remove_if([&](const auto& other) { return &other == client; });
+
+    updateSubscribedMask();
+}
+
+void CEventManager::updateSubscribedMask() {
+    uint64_t mask = 0;
+
+    for (auto& c : m_lClients)
+        mask |= c.eventMask;
+
+    m_iSubscribedMask = mask;
+}
+
+void CEventManager::handleClientCommand(SSocket2Client* client, const std::string& command) {
+    CVarList vars(command, 2, ' ');
+
+    if (vars[0] == "subscribe" || vars[0] == "unsubscribe") {
+        uint64_t bits = 0;
+        for (auto& e : CVarList(vars[1], 0, ',')) {
+            const auto BIT = subscriptionBit(e);
 
-    auto removeFD = [&](int fd) -> void {
-        const auto ACCEPTEDFDS = (std::deque<std::pair<int, wl_event_source*>>*)data;
-        for (auto it = ACCEPTEDFDS->begin(); it != ACCEPTEDFDS->end();) {
-            if (it->first == fd) {
-                wl_event_source_remove(it->second); // remove this fd listener
-                it = ACCEPTEDFDS->erase(it);
-            } else {
-                it++;
+            // a typo would otherwise silently subscribe to the plugin events, reject the whole command
+            if (!BIT) {
+                Debug::log(WARN, "Socket 2 client at FD %d tried to %s to an unknown event: %s", client->fd, vars[0].c_str(), e.c_str());
+                client->outBuffer += "error>>unknown event " + e + "\n";
+                wl_event_source_fd_update(client->source, WL_EVENT_READABLE | WL_EVENT_WRITABLE);
+                return;
             }
+
+            bits |= BIT;
         }
-    };
+
+        if (vars[0] == "subscribe")
+            client->eventMask = (client->eventMask == UINT64_MAX ? 0 : client->eventMask) | bits;
+        else
+            client->eventMask &= ~bits;
+
+        updateSubscribedMask();
+    } else if (vars[0] == "filter") {
+        client->filterMonitor   = vars[1].find("monitor:") == 0 ? vars[1].substr(8) : "";
+        client->filterWorkspace = vars[1].find("workspace:") == 0 ? vars[1].substr(10) : "";
+    } else if (!vars[0].empty())
+        Debug::log(WARN, "Socket 2 client at FD %d sent an unknown command: %s", client->fd, command.c_str());
+}
+
+int CEventManager::onClientEvent(int fd, uint32_t mask, void* data) {
+    const auto CLIENT = (SSocket2Client*)data;
 
     if (mask & WL_EVENT_ERROR || mask & WL_EVENT_HANGUP) {
         // remove, hanged up
-        removeFD(fd);
+        g_pEventManager->removeClient(CLIENT);
         return 0;
     }
 
-    int availableBytes;
-    if (ioctl(fd, FIONREAD, &availableBytes) == -1) {
-        Debug::log(ERR, "fd %d sent invalid data (1)", fd);
-        removeFD(fd);
-        return 0;
+    if (mask & WL_EVENT_READABLE) {
+        char buf[1024];
+        while (true) {
+            const auto RECEIVED = recv(fd, buf, sizeof(buf), 0);
+
+            if (RECEIVED == 0 || (RECEIVED < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) || CLIENT->inBuffer.length() > 4096) {
+                g_pEventManager->removeClient(CLIENT);
+                return 0;
+            }
+
+            if (RECEIVED < 0 && errno != EINTR)
+                break;
+
+            if (RECEIVED > 0)
+                CLIENT->inBuffer.append(buf, RECEIVED);
+        }
+
+        size_t newline = 0;
+        while ((newline = CLIENT->inBuffer.find('\n')) != std::string::npos) {
+            g_pEventManager->handleClientCommand(CLIENT, CLIENT->inBuffer.substr(0, newline));
+            CLIENT->inBuffer.erase(0, newline + 1);
+        }
     }
 
-    char       buf[availableBytes];
-    const auto RECEIVED = recv(fd, buf, availableBytes, 0);
-    if (RECEIVED == -1) {
-        Debug::log(ERR, "fd %d sent invalid data (2)", fd);
-        removeFD(fd);
+    if (mask & WL_EVENT_WRITABLE)
+        g_pEventManager->flushClient(CLIENT);
+
+    return 0;
+}
+
+int CEventManager::onNewClient(int fd, uint32_t mask, void* data) {
+    if (mask & WL_EVENT_ERROR || mask & WL_EVENT_HANGUP)
         return 0;
-    }
+
+    const auto ACCEPTEDCONNECTION = accept4(fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+    if (ACCEPTEDCONNECTION < 0)
+        return 0;
+
+    Debug::log(LOG, "Socket 2 accepted a new client at FD %d", ACCEPTEDCONNECTION);
+
+    const auto PCLIENT = &g_pEventManager->m_lClients.emplace_back();
+    PCLIENT->fd        = ACCEPTEDCONNECTION;
+    PCLIENT->source    = wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, ACCEPTEDCONNECTION, WL_EVENT_READABLE, onClientEvent, PCLIENT);
+
+    g_pEventManager->updateSubscribedMask();
 
     return 0;
 }
 
-void CEventManager::startThread() {
-    m_tThread = std::thread([&]() {
-        const auto SOCKET = socket(AF_UNIX, SOCK_STREAM, 0);
+int CEventManager::onQueueWake(int fd, uint32_t mask, void* data) {
+    eventfd_t value;
+    eventfd_read(fd, &value);
 
-        if (SOCKET < 0) {
-            Debug::log(ERR, "Couldn't start the Hyprland Socket 2. (1) IPC will not work.");
-            return;
-        }
+    g_pEventManager->flushEvents();
+
+    return 0;
+}
+
+void CEventManager::startSocket() {
+    m_iSocketFD = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    m_iWakeFD   = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
 
-        sockaddr_un SERVERADDRESS = {.sun_family = AF_UNIX};
-        std::string socketPath    = "/tmp/hypr/" + g_pCompositor->m_szInstanceSignature + "/.socket2.sock";
-        strcpy(SERVERADDRESS.sun_path, socketPath.c_str());
+    if (m_iSocketFD < 0 || m_iWakeFD < 0) {
+        Debug::log(ERR, "Couldn't start the Hyprland Socket 2. (1) IPC will not work.");
+        return;
+    }
 
-        bind(SOCKET, (sockaddr*)&SERVERADDRESS, SUN_LEN(&SERVERADDRESS));
+    sockaddr_un SERVERADDRESS = {.sun_family = AF_UNIX};
+    std::string socketPath    = "/tmp/hypr/" + g_pCompositor->m_szInstanceSignature + "/.socket2.sock";
+    strcpy(SERVERADDRESS.sun_path, socketPath.c_str());
 
-        // 10 max queued.
-        listen(SOCKET, 10);
+    if (bind(m_iSocketFD, (sockaddr*)&SERVERADDRESS, SUN_LEN(&SERVERADDRESS)) < 0) {
+        Debug::log(ERR, "Couldn't start the Hyprland Socket 2. (2) IPC will not work.");
+        return;
+    }
 
-        sockaddr_in clientAddress;
-        socklen_t   clientSize = sizeof(clientAddress);
+    // 10 max queued.
+    listen(m_iSocketFD, 10);
 
-        Debug::log(LOG, "Hypr socket 2 started at %s", socketPath.c_str());
+    Debug::log(LOG, "Hypr socket 2 started at %s", socketPath.c_str());
 
-        while (1) {
-            const auto ACCEPTEDCONNECTION = accept(SOCKET, (sockaddr*)&clientAddress, &clientSize);
+    wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, m_iSocketFD, WL_EVENT_READABLE, onNewClient, nullptr);
+    wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, m_iWakeFD, WL_EVENT_READABLE, onQueueWake, nullptr);
 
-            if (ACCEPTEDCONNECTION > 0) {
-                // new connection!
+    // events posted before we were up
+    scheduleFlush();
+}
 
-                int flagsNew = fcntl(ACCEPTEDCONNECTION, F_GETFL, 0);
-                fcntl(ACCEPTEDCONNECTION, F_SETFL, flagsNew | O_NONBLOCK);
+void CEventManager::flushClient(SSocket2Client* client) {
+    while (client->outOffset < client->outBuffer.length()) {
+        const auto WRITTEN = write(client->fd, client->outBuffer.data() + client->outOffset, client->outBuffer.length() - client->outOffset);
 
-                Debug::log(LOG, "Socket 2 accepted a new client at FD %d", ACCEPTEDCONNECTION);
+        if (WRITTEN < 0) {
+            if (errno == EINTR)
+                continue;
 
-                // add to event loop so we can close it when we need to
-                m_dAcceptedSocketFDs.push_back(
-                    {ACCEPTEDCONNECTION, wl_event_loop_add_fd(g_pCompositor->m_sWLEventLoop, ACCEPTEDCONNECTION, WL_EVENT_READABLE, fdHandleWrite, &m_dAcceptedSocketFDs)});
-            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+
+            removeClient(client);
+            return;
         }
 
-        close(SOCKET);
-    });
+        client->outOffset += WRITTEN;
+    }
+
+    if (client->outOffset == client->outBuffer.length()) {
+        client->outBuffer.clear();
+        client->outOffset = 0;
+    }
 
-    m_tThread.detach();
+    wl_event_source_fd_update(client->source, client->outBuffer.empty() ? WL_EVENT_READABLE : WL_EVENT_READABLE | WL_EVENT_WRITABLE);
 }
 
 void CEventManager::flushEvents() {
-    eventQueueMutex.lock();
+    TRACE_SCOPE("ipc", "socket2Flush");
+
+    // cleared before draining, a post racing with us schedules another flush instead of getting lost
+    m_bFlushScheduled = false;
 
-    for (auto& ev : m_dQueuedEvents) {
-        std::string eventString = (ev.event + ">>" + ev.data).substr(0, 1022) + "\n";
-        for (auto& fd : m_dAcceptedSocketFDs) {
-            write(fd.first, eventString.c_str(), eventString.length());
+    // the snapshot is main thread only, posts just collect what they invalidate
+    if (const auto SECTIONS = m_iSnapshotSections.exchange(0); SECTIONS)
+        HyprCtl::markStateChanged(SECTIONS);
+
+    if (const auto DROPPED = m_iDroppedEvents.exchange(0); DROPPED > 0)
+        Debug::log(WARN, "Socket 2 queue overflowed, dropped %lu events", DROPPED);
+
+    SQueuedIPCEvent event;
+    while (m_rbQueuedEvents.pop(event)) {
+        for (auto& c : m_lClients) {
+            if (!(c.eventMask & event.type))
+                continue;
+
+            if (!c.filterMonitor.empty() && !event.monitor.empty() && c.filterMonitor != event.monitor)
+                continue;
+
+            if (!c.filterWorkspace.empty() && !event.workspace.empty() && c.filterWorkspace != event.workspace)
+                continue;
+
+            c.outBuffer += event.line;
         }
     }
 
-    m_dQueuedEvents.clear();
+    for (auto it = m_lClients.begin(); it != m_lClients.end();) {
+        auto& client = *it++; // flushClient may remove it
+
+        if (client.outBuffer.length() - client.outOffset > MAX_CLIENT_BACKLOG) {
+            Debug::log(WARN, "Socket 2 client at FD %d isn't reading its events, disconnecting it", client.fd);
+            removeClient(&client);
+            continue;
+        }
 
-    eventQueueMutex.unlock();
+        flushClient(&client);
+    }
 }
 
 void CEventManager::postEvent(const SHyprIPCEvent event, bool force) {
@@ -124,14 +299,41 @@ void CEventManager::postEvent(const SHyprIPCEvent event, bool force) {
         return;
     }
 
-    std::thread(
-        [&](const SHyprIPCEvent ev) {
-            eventQueueMutex.lock();
-            m_dQueuedEvents.push_back(ev);
-            eventQueueMutex.unlock();
+    // only wake the loop for the snapshot if this adds a section
+    const auto SECTIONS   = snapshotSections(event.event);
+    const bool NEWLYDIRTY = (m_iSnapshotSections.fetch_or(SECTIONS) & SECTIONS) != SECTIONS;
+
+    const auto TYPE = eventBit(event.event);
+
+    // nobody listens, don't even format it
+    if (!(m_iSubscribedMask & TYPE)) {
+        if (NEWLYDIRTY)
+            scheduleFlush();
+
+        return;
+    }
+
+    if (!m_rbQueuedEvents.push(SQueuedIPCEvent{TYPE, event.monitor, event.workspace, (event.event + ">>" + event.data).substr(0, 1022) + "\n"})) {
+        m_iDroppedEvents++;
+
+        if (NEWLYDIRTY)
+            scheduleFlush();
+
+        return;
+    }
+
+    scheduleFlush();
+}
+
+void CEventManager::scheduleFlush() {
+    // before startSocket, whatever piled up is handed over once the wake fd exists
+    if (m_iWakeFD < 0)
+        return;
+
+    if (!m_bFlushScheduled.exchange(true))
+        eventfd_write(m_iWakeFD, 1);
+}
 
-            flushEvents();
-        },
-        event)
-        .detach();
+bool CEventManager::wantsEvent(const std::string& event) {
+    return m_iSubscribedMask & eventBit(event);
 }
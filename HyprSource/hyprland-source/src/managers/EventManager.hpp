@@ -1,35 +1,94 @@
 #pragma once
-#include <deque>
+#include <atomic>
 #include <fstream>
-#include <mutex>
+#include <list>
 
 #include "../defines.hpp"
 #include "../helpers/MiscFunctions.hpp"
+#include "../helpers/RingBuffer.hpp"
+
+class CWindow;
 
 struct SHyprIPCEvent {
     std::string event;
     std::string data;
+
+    // optional, lets clients filtering on a monitor or workspace skip the event
+    std::string monitor   = "";
+    std::string workspace = "";
+};
+
+// an event scoped to the window's monitor and workspace
+SHyprIPCEvent windowIPCEvent(const std::string& event, const std::string& data, CWindow* pWindow);
+
+// a posted event, already formatted
+struct SQueuedIPCEvent {
+    uint64_t    type = 0;
+    std::string monitor;
+    std::string workspace;
+    std::string line;
+};
+
+// events posted but not yet handed to clients, anything past this is dropped
+constexpr size_t EVENT_QUEUE_SIZE = 4096;
+// a client with more unread bytes than this gets disconnected
+constexpr size_t MAX_CLIENT_BACKLOG = 1024 * 1024;
+
+// socket2 clients get every event until they send a subscription, one command per line:
+// "subscribe <event>[,<event>...]" to only get these (adds up), "unsubscribe <event>[,<event>...]",
+// where "other" covers every event hyprland doesn't post itself (e.g. from plugins) and unknown names get an "error>>" line back,
+// "filter monitor:<name>", "filter workspace:<name>" or "filter none", each replacing the previous filter.
+// filters skip events of other monitors / workspaces, events that belong to neither are always sent.
+struct SSocket2Client {
+    int              fd     = -1;
+    wl_event_source* source = nullptr;
+
+    uint64_t         eventMask       = UINT64_MAX;
+    std::string      filterMonitor   = "";
+    std::string      filterWorkspace = "";
+
+    std::string      inBuffer  = "";
+    std::string      outBuffer = "";
+    size_t           outOffset = 0;
 };
 
 class CEventManager {
   public:
     CEventManager();
+    ~CEventManager();
 
-    void        postEvent(const SHyprIPCEvent event, bool force = false);
+    // thread-safe, never blocks
+    void postEvent(const SHyprIPCEvent event, bool force = false);
 
-    void        startThread();
+    // whether any client would get this event, check before building expensive event data
+    bool wantsEvent(const std::string& event);
 
-    bool        m_bIgnoreEvents = false;
+    void startSocket();
 
-    std::thread m_tThread;
+    bool m_bIgnoreEvents = false;
 
   private:
-    void                                         flushEvents();
+    void                                           flushEvents();
+    void                                           flushClient(SSocket2Client* client);
+    void                                           removeClient(SSocket2Client* client);
+    void                                           handleClientCommand(SSocket2Client* client, const std::string& command);
+    void                                           updateSubscribedMask();
+    void                                           scheduleFlush();
+
+    static int                                     onNewClient(int fd, uint32_t mask, void* data);
+    static int                                     onClientEvent(int fd, uint32_t mask, void* data);
+    static int                                     onQueueWake(int fd, uint32_t mask, void* data);
+
+    int                                            m_iSocketFD = -1;
+    int                                            m_iWakeFD   = -1;
 
-    std::mutex                                   eventQueueMutex;
-    std::deque<SHyprIPCEvent>                    m_dQueuedEvents;
+    CRingBuffer<SQueuedIPCEvent, EVENT_QUEUE_SIZE> m_rbQueuedEvents;
+    std::atomic<bool>                              m_bFlushScheduled   = false;
+    std::atomic<size_t>                            m_iDroppedEvents    = 0;
+    std::atomic<uint64_t>                          m_iSubscribedMask   = 0;
+    std::atomic<uint32_t>                          m_iSnapshotSections = 0; // hyprctl snapshot sections invalidated by posted events, handed over by flushEvents
 
-    std::deque<std::pair<int, wl_event_source*>> m_dAcceptedSocketFDs;
+    std::list<SSocket2Client>                      m_lClients;
 };
 
-inline std::unique_ptr<CEventManager> g_pEventManager;
\ No newline at end of file
+inline std::unique_ptr<CEventManager> g_pEventManager;
@@ -11,6 +11,11 @@
 #include <sys/consio.h>
 #endif
 
+template <typename T>
+static SParsedDispatcher makeParsedDispatcher(T (*parse)(const std::string&), void (*call)(const T&)) {
+    return {[parse](const std::string& args) -> DISPATCHER_ARG { return parse(args); }, [call](const DISPATCHER_ARG& arg) { call(std::get<T>(arg)); }};
+}
+
 CKeybindManager::CKeybindManager() {
     // initialize all dispatchers
 
@@ -65,13 +70,36 @@ CKeybindManager::CKeybindManager() {
     m_mDispatchers["moveoutofgroup"]                = moveOutOfGroup;
     m_mDispatchers["global"]                        = global;
 
+    m_mParsedDispatchers["resizeactive"]       = makeParsedDispatcher(parseWindowVector, resizeActiveParsed);
+    m_mParsedDispatchers["moveactive"]         = makeParsedDispatcher(parseWindowVector, moveActiveParsed);
+    m_mParsedDispatchers["movewindowpixel"]    = makeParsedDispatcher(parseWindowVectorSelector, moveWindowParsed);
+    m_mParsedDispatchers["resizewindowpixel"]  = makeParsedDispatcher(parseWindowVectorSelector, resizeWindowParsed);
+    m_mParsedDispatchers["movefocus"]          = makeParsedDispatcher(parseDirection, moveFocusToParsed);
+    m_mParsedDispatchers["splitratio"]         = makeParsedDispatcher(parseSplitRatio, alterSplitRatioParsed);
+    m_mParsedDispatchers["focuswindowbyclass"] = makeParsedDispatcher(parseWindowSelector, focusWindowParsed);
+    m_mParsedDispatchers["focuswindow"]        = makeParsedDispatcher(parseWindowSelector, focusWindowParsed);
+
     m_tScrollTimer.reset();
 }
 
 void CKeybindManager::addKeybind(SKeybind kb) {
+    // resolve once here instead of on every key event
+    kb.keysym      = xkb_keysym_from_name(kb.key.c_str(), XKB_KEYSYM_CASE_INSENSITIVE);
+    kb.keysymUpper = xkb_keysym_to_upper(kb.keysym);
+
+    if (const auto PARSED = m_mParsedDispatchers.find(kb.handler); PARSED != m_mParsedDispatchers.end() && !kb.mouse) {
+        try {
+            kb.parsedArg = PARSED->second.parse(kb.arg);
+        } catch (std::exception& e) {
+            // e.g. a bad regex, leave it to the string dispatcher to fail the same way at runtime
+            Debug::log(ERR, "Couldn't parse the argument of a %s bind: %s", kb.handler.c_str(), e.what());
+        }
+    }
+
     m_lKeybinds.push_back(kb);
 
-    m_pActiveKeybind = nullptr;
+    m_pActiveKeybind     = nullptr;
+    m_bKeybindIndexDirty = true;
 }
 
 void CKeybindManager::removeKeybind(uint32_t mod, const std::string& key) {
@@ -93,7 +121,8 @@ void CKeybindManager::removeKeybind(uint32_t mod, const std::string& key) {
         }
     }
 
-    m_pActiveKeybind = nullptr;
+    m_pActiveKeybind     = nullptr;
+    m_bKeybindIndexDirty = true;
 }
 
 uint32_t CKeybindManager::stringToModMask(std::string mods) {
@@ -126,12 +155,12 @@ void CKeybindManager::updateXKBTranslationState() {
         m_pXKBTranslationState = nullptr;
     }
 
-    const auto     FILEPATH = g_pConfigManager->getString("input:kb_file");
-    const auto     RULES    = g_pConfigManager->getString("input:kb_rules");
-    const auto     MODEL    = g_pConfigManager->getString("input:kb_model");
-    const auto     LAYOUT   = g_pConfigManager->getString("input:kb_layout");
-    const auto     VARIANT  = g_pConfigManager->getString("input:kb_variant");
-    const auto     OPTIONS  = g_pConfigManager->getString("input:kb_options");
+    const auto     FILEPATH = g_pConfigManager->getString(CFG_INPUT_KB_FILE);
+    const auto     RULES    = g_pConfigManager->getString(CFG_INPUT_KB_RULES);
+    const auto     MODEL    = g_pConfigManager->getString(CFG_INPUT_KB_MODEL);
+    const auto     LAYOUT   = g_pConfigManager->getString(CFG_INPUT_KB_LAYOUT);
+    const auto     VARIANT  = g_pConfigManager->getString(CFG_INPUT_KB_VARIANT);
+    const auto     OPTIONS  = g_pConfigManager->getString(CFG_INPUT_KB_OPTIONS);
 
     xkb_rule_names rules = {.rules = RULES.c_str(), .model = MODEL.c_str(), .layout = LAYOUT.c_str(), .variant = VARIANT.c_str(), .options = OPTIONS.c_str()};
 
@@ -250,7 +279,7 @@ bool CKeybindManager::onKeyEvent(wlr_keyboard_key_event* e, SKeyboard* pKeyboard
 bool CKeybindManager::onAxisEvent(wlr_pointer_axis_event* e) {
     const auto         MODS = g_pInputManager->accumulateModsFromAllKBs();
 
-    static auto* const PDELAY = &g_pConfigManager->getConfigValuePtr("binds:scroll_event_delay")->intValue;
+    static auto* const PDELAY = &g_pConfigManager->getConfigValuePtr(CFG_BINDS_SCROLL_EVENT_DELAY)->intValue;
 
     if (m_tScrollTimer.getMillis() < *PDELAY) {
         m_tScrollTimer.reset();
@@ -323,6 +352,18 @@ void CKeybindManager::onSwitchOffEvent(const std::string& switchName) {
     handleKeybinds(0, "switch:off:" + switchName, 0, 0, true, 0);
 }
 
+// calls the pre-parsed variant of a bind's dispatcher if there is one
+static void callKeybindDispatcher(const SKeybind& k, const std::function<void(std::string)>& dispatcher) {
+    const auto PARSED = g_pKeybindManager->m_mParsedDispatchers.find(k.handler);
+
+    if (PARSED != g_pKeybindManager->m_mParsedDispatchers.end() && !std::holds_alternative<std::monostate>(k.parsedArg))
+        PARSED->second.call(k.parsedArg);
+    else
+        dispatcher(k.arg);
+
+    HyprCtl::markStateChanged();
+}
+
 int repeatKeyHandler(void* data) {
     SKeybind** ppActiveKeybind = (SKeybind**)data;
 
@@ -332,13 +373,67 @@ int repeatKeyHandler(void* data) {
     const auto DISPATCHER = g_pKeybindManager->m_mDispatchers.find((*ppActiveKeybind)->handler);
 
     Debug::log(LOG, "Keybind repeat triggered, calling dispatcher.");
-    DISPATCHER->second((*ppActiveKeybind)->arg);
+    callKeybindDispatcher(**ppActiveKeybind, DISPATCHER->second);
 
     wl_event_source_timer_update(g_pKeybindManager->m_pActiveKeybindEventSource, 1000 / g_pInputManager->m_pActiveKeyboard->repeatRate);
 
     return 0;
 }
 
+static uint64_t keybindLookupKey(uint32_t modmask, bool isKeycode, uint32_t code) {
+    return ((uint64_t)modmask << 33) | ((uint64_t)isKeycode << 32) | code;
+}
+
+void CKeybindManager::rebuildKeybindIndex() {
+    m_mKeybindIndex.clear();
+
+    for (auto& k : m_lKeybinds) {
+        auto& submap = m_mKeybindIndex[k.submap];
+
+        if (k.keycode != -1) {
+            submap.codes[keybindLookupKey(k.modmask, true, k.keycode)].push_back(&k);
+            continue;
+        }
+
+        if (k.key.empty())
+            continue;
+
+        submap.names[k.key].push_back(&k);
+
+        // a keysym bind matches both cases
+        if (k.keysym != 0) {
+            submap.codes[keybindLookupKey(k.modmask, false, k.keysym)].push_back(&k);
+
+            if (k.keysymUpper != k.keysym)
+                submap.codes[keybindLookupKey(k.modmask, false, k.keysymUpper)].push_back(&k);
+        }
+    }
+
+    m_bKeybindIndexDirty = false;
+}
+
+// callers set exactly one of key, keysym and keycode
+const std::vector<SKeybind*>* CKeybindManager::findKeybinds(const uint32_t& modmask, const std::string& key, const xkb_keysym_t& keysym, const int& keycode) {
+    if (m_bKeybindIndexDirty)
+        rebuildKeybindIndex();
+
+    const auto SUBMAP = m_mKeybindIndex.find(m_szCurrentSelectedSubmap);
+
+    if (SUBMAP == m_mKeybindIndex.end())
+        return nullptr;
+
+    if (!key.empty()) {
+        const auto IT = SUBMAP->second.names.find(key);
+        return IT == SUBMAP->second.names.end() ? nullptr : &IT->second;
+    }
+
+    if (keysym == 0 && keycode <= 0)
+        return nullptr;
+
+    const auto IT = SUBMAP->second.codes.find(keysym != 0 ? keybindLookupKey(modmask, false, keysym) : keybindLookupKey(modmask, true, keycode));
+    return IT == SUBMAP->second.codes.end() ? nullptr : &IT->second;
+}
+
 bool CKeybindManager::handleKeybinds(const uint32_t& modmask, const std::string& key, const xkb_keysym_t& keysym, const int& keycode, bool pressed, uint32_t time) {
     bool found = false;
 
@@ -351,30 +446,19 @@ bool CKeybindManager::handleKeybinds(const uint32_t& modmask, const std::string&
         m_kHeldBack = 0;
     }
 
-    for (auto& k : m_lKeybinds) {
-        if (modmask != k.modmask || (g_pCompositor->m_sSeat.exclusiveClient && !k.locked) || k.submap != m_szCurrentSelectedSubmap ||
-            (!pressed && !k.release && k.handler != "pass" && k.handler != "mouse" && k.handler != "global") || k.shadowed)
-            continue;
+    // only binds of the current submap with a matching key, keysym or keycode, in config order
+    const auto PKEYBINDS = findKeybinds(modmask, key, keysym, keycode);
 
-        if (!key.empty()) {
-            if (key != k.key)
-                continue;
-        } else if (k.keycode != -1) {
-            if (keycode != k.keycode)
-                continue;
-        } else {
-            if (keysym == 0)
-                continue; // this is a keycode check run
+    if (!PKEYBINDS)
+        return false;
 
-            // oMg such performance hit!!11!
-            // this little maneouver is gonna cost us 4µs
-            const auto KBKEY      = xkb_keysym_from_name(k.key.c_str(), XKB_KEYSYM_CASE_INSENSITIVE);
-            const auto KBKEYUPPER = xkb_keysym_to_upper(KBKEY);
-            // small TODO: fix 0-9 keys and other modified ones with shift
+    for (auto* const PKEYBIND : *PKEYBINDS) {
+        auto& k = *PKEYBIND;
 
-            if (keysym != KBKEY && keysym != KBKEYUPPER)
-                continue;
-        }
+        // small TODO: fix 0-9 keys and other modified ones with shift
+        if (modmask != k.modmask || (g_pCompositor->m_sSeat.exclusiveClient && !k.locked) ||
+            (!pressed && !k.release && k.handler != "pass" && k.handler != "mouse" && k.handler != "global") || k.shadowed)
+            continue;
 
         if (pressed && k.release) {
             // suppress down event
@@ -396,7 +480,7 @@ bool CKeybindManager::handleKeybinds(const uint32_t& modmask, const std::string&
             if (k.handler == "mouse")
                 DISPATCHER->second((pressed ? "1" : "0") + k.arg);
             else
-                DISPATCHER->second(k.arg);
+                callKeybindDispatcher(k, DISPATCHER->second);
 
             m_iPassPressed = -1;
 
@@ -431,11 +515,8 @@ void CKeybindManager::shadowKeybinds(const xkb_keysym_t& doesntHave, const int&
         if (k.handler == "global")
             continue; // can't be shadowed
 
-        const auto KBKEY      = xkb_keysym_from_name(k.key.c_str(), XKB_KEYSYM_CASE_INSENSITIVE);
-        const auto KBKEYUPPER = xkb_keysym_to_upper(KBKEY);
-
         for (auto& pk : m_dPressedKeysyms) {
-            if ((pk == KBKEY || pk == KBKEYUPPER)) {
+            if ((pk == k.keysym || pk == k.keysymUpper)) {
                 shadow = true;
 
                 if (pk == doesntHave && doesntHave != 0) {
@@ -626,6 +707,8 @@ void CKeybindManager::kill(std::string args) {
 
 void CKeybindManager::clearKeybinds() {
     m_lKeybinds.clear();
+
+    m_bKeybindIndexDirty = true;
 }
 
 void CKeybindManager::toggleActiveFloating(std::string args) {
@@ -725,7 +808,7 @@ void CKeybindManager::changeworkspace(std::string args) {
 
             // If the previous workspace ID isn't reset, cycles can form when continually going
             // to the previous workspace again and again.
-            static auto* const PALLOWWORKSPACECYCLES = &g_pConfigManager->getConfigValuePtr("binds:allow_workspace_cycles")->intValue;
+            static auto* const PALLOWWORKSPACECYCLES = &g_pConfigManager->getConfigValuePtr(CFG_BINDS_ALLOW_WORKSPACE_CYCLES)->intValue;
             if (!*PALLOWWORKSPACECYCLES)
                 PCURRENTWORKSPACE->m_sPrevWorkspace = {-1, ""};
             else
@@ -743,7 +826,7 @@ void CKeybindManager::changeworkspace(std::string args) {
     // Workspace_back_and_forth being enabled means that an attempt to switch to
     // the current workspace will instead switch to the previous.
     const auto         PCURRENTWORKSPACE = g_pCompositor->getWorkspaceByID(g_pCompositor->m_pLastMonitor->activeWorkspace);
-    static auto* const PBACKANDFORTH     = &g_pConfigManager->getConfigValuePtr("binds:workspace_back_and_forth")->intValue;
+    static auto* const PBACKANDFORTH     = &g_pConfigManager->getConfigValuePtr(CFG_BINDS_WORKSPACE_BACK_AND_FORTH)->intValue;
 
     if (*PBACKANDFORTH && PCURRENTWORKSPACE && PCURRENTWORKSPACE->m_iID == workspaceToChangeTo && PCURRENTWORKSPACE->m_sPrevWorkspace.iID != -1 && !internal) {
 
@@ -758,7 +841,7 @@ void CKeybindManager::changeworkspace(std::string args) {
 
         // If the previous workspace ID isn't reset, cycles can form when continually going
         // to the previous workspace again and again.
-        static auto* const PALLOWWORKSPACECYCLES = &g_pConfigManager->getConfigValuePtr("binds:allow_workspace_cycles")->intValue;
+        static auto* const PALLOWWORKSPACECYCLES = &g_pConfigManager->getConfigValuePtr(CFG_BINDS_ALLOW_WORKSPACE_CYCLES)->intValue;
         if (!*PALLOWWORKSPACECYCLES)
             PCURRENTWORKSPACE->m_sPrevWorkspace = {-1, ""};
         else
@@ -818,7 +901,7 @@ void CKeybindManager::changeworkspace(std::string args) {
             // start anim on new workspace
             PWORKSPACETOCHANGETO->startAnim(true, ANIMTOLEFT);
 
-            g_pEventManager->postEvent(SHyprIPCEvent{"workspace", PWORKSPACETOCHANGETO->m_szName});
+            g_pEventManager->postEvent(SHyprIPCEvent{"workspace", PWORKSPACETOCHANGETO->m_szName, PMONITOR->szName, PWORKSPACETOCHANGETO->m_szName});
             EMIT_HOOK_EVENT("workspace", PWORKSPACETOCHANGETO);
         }
 
@@ -915,7 +998,7 @@ void CKeybindManager::changeworkspace(std::string args) {
     if (g_pCompositor->m_pLastMonitor != PMONITOR)
         g_pCompositor->warpCursorTo(PMONITOR->vecPosition + PMONITOR->vecSize / 2.f);
 
-    g_pEventManager->postEvent(SHyprIPCEvent{"workspace", PWORKSPACE->m_szName});
+    g_pEventManager->postEvent(SHyprIPCEvent{"workspace", PWORKSPACE->m_szName, PMONITOR->szName, PWORKSPACE->m_szName});
     EMIT_HOOK_EVENT("workspace", PWORKSPACE);
 
     g_pCompositor->setActiveMonitor(PMONITOR);
@@ -1098,7 +1181,7 @@ void CKeybindManager::moveActiveToWorkspaceSilent(std::string args) {
     g_pEventManager->m_bIgnoreEvents = false;
 
     // manually post event cuz it got ignored above
-    g_pEventManager->postEvent(SHyprIPCEvent{"movewindow", getFormat("%x,%s", PWINDOW, PWORKSPACE->m_szName.c_str())});
+    g_pEventManager->postEvent(windowIPCEvent("movewindow", getFormat("%x,%s", PWINDOW, PWORKSPACE->m_szName.c_str()), PWINDOW));
     EMIT_HOOK_EVENT("moveWindow", (std::vector<void*>{PWINDOW, PWORKSPACE}));
 
     PWINDOW->m_iWorkspaceID   = OLDWORKSPACEIDRETURN;
@@ -1109,12 +1192,14 @@ void CKeybindManager::moveActiveToWorkspaceSilent(std::string args) {
 }
 
 void CKeybindManager::moveFocusTo(std::string args) {
-    char arg = args[0];
+    moveFocusToParsed(parseDirection(args));
+}
 
-    if (!isDirection(args)) {
-        Debug::log(ERR, "Cannot move focus in direction %c, unsupported direction. Supported: l,r,u/t,d/b", arg);
+void CKeybindManager::moveFocusToParsed(const SDirection& direction) {
+    const char arg = direction.direction;
+
+    if (!arg)
         return;
-    }
 
     const auto PLASTWINDOW = g_pCompositor->m_pLastWindow;
 
@@ -1366,34 +1451,19 @@ void CKeybindManager::toggleSplit(std::string args) {
 }
 
 void CKeybindManager::alterSplitRatio(std::string args) {
-    float splitratio = 0;
-    bool  exact      = false;
-
-    if (args == "+" || args == "-") {
-        Debug::log(LOG, "alterSplitRatio: using LEGACY +/-, consider switching to the Hyprland syntax.");
-        splitratio = (args == "+" ? 0.05f : -0.05f);
-    }
-
-    if (splitratio == 0) {
-        if (args.find("exact") == 0) {
-            exact      = true;
-            splitratio = getPlusMinusKeywordResult(args.substr(5), 0);
-        } else {
-            splitratio = getPlusMinusKeywordResult(args, 0);
-        }
-    }
+    alterSplitRatioParsed(parseSplitRatio(args));
+}
 
-    if (splitratio == INT_MAX) {
-        Debug::log(ERR, "Splitratio invalid in alterSplitRatio!");
+void CKeybindManager::alterSplitRatioParsed(const SSplitRatio& ratio) {
+    if (!ratio.valid)
         return;
-    }
 
     const auto PLASTWINDOW = g_pCompositor->m_pLastWindow;
 
     if (!PLASTWINDOW)
         return;
 
-    g_pLayoutManager->getCurrentLayout()->alterSplitRatio(PLASTWINDOW, splitratio, exact);
+    g_pLayoutManager->getCurrentLayout()->alterSplitRatio(PLASTWINDOW, ratio.ratio, ratio.exact);
 }
 
 void CKeybindManager::focusMonitor(std::string arg) {
@@ -1581,7 +1651,7 @@ void CKeybindManager::moveWorkspaceToMonitor(std::string args) {
 
 void CKeybindManager::toggleSpecialWorkspace(std::string args) {
 
-    static auto* const PFOLLOWMOUSE = &g_pConfigManager->getConfigValuePtr("input:follow_mouse")->intValue;
+    static auto* const PFOLLOWMOUSE = &g_pConfigManager->getConfigValuePtr(CFG_INPUT_FOLLOW_MOUSE)->intValue;
 
     std::string        workspaceName = "";
     int                workspaceID   = getWorkspaceIDFromString("special:" + args, workspaceName);
@@ -1695,10 +1765,14 @@ void CKeybindManager::forceRendererReload(std::string args) {
 }
 
 void CKeybindManager::resizeActive(std::string args) {
+    resizeActiveParsed(parseWindowVector(args));
+}
+
+void CKeybindManager::resizeActiveParsed(const SWindowVector& size) {
     if (!g_pCompositor->m_pLastWindow || g_pCompositor->m_pLastWindow->m_bIsFullscreen)
         return;
 
-    const auto SIZ = g_pCompositor->parseWindowVectorArgsRelative(args, g_pCompositor->m_pLastWindow->m_vRealSize.goalv());
+    const auto SIZ = applyWindowVector(size, g_pCompositor->m_pLastWindow->m_vRealSize.goalv());
 
     g_pLayoutManager->getCurrentLayout()->resizeActiveWindow(SIZ - g_pCompositor->m_pLastWindow->m_vRealSize.goalv());
 
@@ -1707,20 +1781,24 @@ void CKeybindManager::resizeActive(std::string args) {
 }
 
 void CKeybindManager::moveActive(std::string args) {
+    moveActiveParsed(parseWindowVector(args));
+}
+
+void CKeybindManager::moveActiveParsed(const SWindowVector& pos) {
     if (!g_pCompositor->m_pLastWindow || g_pCompositor->m_pLastWindow->m_bIsFullscreen)
         return;
 
-    const auto POS = g_pCompositor->parseWindowVectorArgsRelative(args, g_pCompositor->m_pLastWindow->m_vRealPosition.goalv());
+    const auto POS = applyWindowVector(pos, g_pCompositor->m_pLastWindow->m_vRealPosition.goalv());
 
     g_pLayoutManager->getCurrentLayout()->moveActiveWindow(POS - g_pCompositor->m_pLastWindow->m_vRealPosition.goalv());
 }
 
 void CKeybindManager::moveWindow(std::string args) {
+    moveWindowParsed(parseWindowVectorSelector(args));
+}
 
-    const auto WINDOWREGEX = args.substr(args.find_first_of(',') + 1);
-    const auto MOVECMD     = args.substr(0, args.find_first_of(','));
-
-    const auto PWINDOW = g_pCompositor->getWindowByRegex(WINDOWREGEX);
+void CKeybindManager::moveWindowParsed(const SWindowVectorSelector& args) {
+    const auto PWINDOW = g_pCompositor->getWindowBySelector(args.window);
 
     if (!PWINDOW) {
         Debug::log(ERR, "moveWindow: no window");
@@ -1730,17 +1808,17 @@ void CKeybindManager::moveWindow(std::string args) {
     if (PWINDOW->m_bIsFullscreen)
         return;
 
-    const auto POS = g_pCompositor->parseWindowVectorArgsRelative(MOVECMD, PWINDOW->m_vRealPosition.goalv());
+    const auto POS = applyWindowVector(args.vector, PWINDOW->m_vRealPosition.goalv());
 
     g_pLayoutManager->getCurrentLayout()->moveActiveWindow(POS - PWINDOW->m_vRealPosition.goalv(), PWINDOW);
 }
 
 void CKeybindManager::resizeWindow(std::string args) {
+    resizeWindowParsed(parseWindowVectorSelector(args));
+}
 
-    const auto WINDOWREGEX = args.substr(args.find_first_of(',') + 1);
-    const auto MOVECMD     = args.substr(0, args.find_first_of(','));
-
-    const auto PWINDOW = g_pCompositor->getWindowByRegex(WINDOWREGEX);
+void CKeybindManager::resizeWindowParsed(const SWindowVectorSelector& args) {
+    const auto PWINDOW = g_pCompositor->getWindowBySelector(args.window);
 
     if (!PWINDOW) {
         Debug::log(ERR, "resizeWindow: no window");
@@ -1750,7 +1828,7 @@ void CKeybindManager::resizeWindow(std::string args) {
     if (PWINDOW->m_bIsFullscreen)
         return;
 
-    const auto SIZ = g_pCompositor->parseWindowVectorArgsRelative(MOVECMD, PWINDOW->m_vRealSize.goalv());
+    const auto SIZ = applyWindowVector(args.vector, PWINDOW->m_vRealSize.goalv());
 
     g_pLayoutManager->getCurrentLayout()->resizeActiveWindow(SIZ - PWINDOW->m_vRealSize.goalv(), PWINDOW);
 
@@ -1799,7 +1877,11 @@ void CKeybindManager::circleNext(std::string arg) {
 }
 
 void CKeybindManager::focusWindow(std::string regexp) {
-    const auto PWINDOW = g_pCompositor->getWindowByRegex(regexp);
+    focusWindowParsed(parseWindowSelector(regexp));
+}
+
+void CKeybindManager::focusWindowParsed(const SWindowSelector& selector) {
+    const auto PWINDOW = g_pCompositor->getWindowBySelector(selector);
 
     if (!PWINDOW)
         return;
@@ -1949,6 +2031,7 @@ void CKeybindManager::dpms(std::string arg) {
         wlr_output_enable(m->output, enable);
 
         m->dpmsStatus = enable;
+        HyprCtl::markStateChanged(SNAPSHOT_MONITORS);
 
         if (!wlr_output_commit(m->output)) {
             Debug::log(ERR, "Couldn't commit output %s", m->szName.c_str());
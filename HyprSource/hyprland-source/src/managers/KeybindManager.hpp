@@ -3,6 +3,7 @@
 #include "../defines.hpp"
 #include <deque>
 #include "../Compositor.hpp"
+#include "../helpers/DispatcherArgs.hpp"
 #include <unordered_map>
 #include <functional>
 
@@ -22,16 +23,25 @@ struct SKeybind {
     bool        repeat  = false;
     bool        mouse   = false;
 
+    // resolved from key and arg by addKeybind
+    xkb_keysym_t   keysym      = 0;
+    xkb_keysym_t   keysymUpper = 0;
+    DISPATCHER_ARG parsedArg;
+
     // DO NOT INITIALIZE
     bool shadowed = false;
 };
 
-enum eFocusWindowMode
-{
-    MODE_CLASS_REGEX = 0,
-    MODE_TITLE_REGEX,
-    MODE_ADDRESS,
-    MODE_PID
+// a dispatcher that can take its argument parsed in advance, so that binds don't re-parse it on every press or repeat
+struct SParsedDispatcher {
+    std::function<DISPATCHER_ARG(const std::string&)> parse;
+    std::function<void(const DISPATCHER_ARG&)>        call;
+};
+
+// binds of one submap, in m_lKeybinds order
+struct SKeybindSubmapIndex {
+    std::unordered_map<uint64_t, std::vector<SKeybind*>>    codes; // by modmask and keysym / keycode, see keybindLookupKey
+    std::unordered_map<std::string, std::vector<SKeybind*>> names; // by key, for mouse, scroll and switch binds
 };
 
 class CKeybindManager {
@@ -53,6 +63,7 @@ class CKeybindManager {
     void                                                              shadowKeybinds(const xkb_keysym_t& doesntHave = 0, const int& doesntHaveCode = 0);
 
     std::unordered_map<std::string, std::function<void(std::string)>> m_mDispatchers;
+    std::unordered_map<std::string, SParsedDispatcher>                 m_mParsedDispatchers; // used by binds instead of m_mDispatchers if present
 
     wl_event_source*                                                  m_pActiveKeybindEventSource = nullptr;
 
@@ -141,6 +152,22 @@ class CKeybindManager {
     static void     moveOutOfGroup(std::string);
     static void     global(std::string);
 
+    // pre-parsed variants, see m_mParsedDispatchers
+    static void resizeActiveParsed(const SWindowVector&);
+    static void moveActiveParsed(const SWindowVector&);
+    static void moveWindowParsed(const SWindowVectorSelector&);
+    static void resizeWindowParsed(const SWindowVectorSelector&);
+    static void moveFocusToParsed(const SDirection&);
+    static void alterSplitRatioParsed(const SSplitRatio&);
+    static void focusWindowParsed(const SWindowSelector&);
+
+    // handleKeybinds lookup, rebuilt lazily after m_lKeybinds changes
+    std::unordered_map<std::string, SKeybindSubmapIndex> m_mKeybindIndex; // by submap
+    bool                                                 m_bKeybindIndexDirty = true;
+
+    void                                                 rebuildKeybindIndex();
+    const std::vector<SKeybind*>*                        findKeybinds(const uint32_t&, const std::string&, const xkb_keysym_t&, const int&);
+
     friend class CCompositor;
     friend class CInputManager;
     friend class CConfigManager;
@@ -1,4 +1,6 @@
 #include "LayoutManager.hpp"
+#include "../Compositor.hpp"
+#include "../debug/Allocations.hpp"
 
 CLayoutManager::CLayoutManager() {
     m_vLayouts.emplace_back(std::make_pair<>("dwindle", &m_cDwindleLayout));
@@ -52,3 +54,91 @@ bool CLayoutManager::removeLayout(IHyprLayout* layout) {
 
     return true;
 }
+
+std::string CLayoutManager::benchmarkLayouts(int iterations, int windows) {
+    const auto PMONITOR = g_pCompositor->m_pLastMonitor;
+
+    if (!PMONITOR)
+        return "no monitor";
+
+    // everything below runs without returning to the event loop, keep it short
+    iterations = std::clamp(iterations, 1, LAYOUTBENCH_MAX_ITERATIONS);
+    windows    = std::clamp(windows, 2, LAYOUTBENCH_MAX_WINDOWS);
+
+    // a mock workspace is swapped in as the focused monitor's active one while this runs, so recalculateMonitor only lays out the mocks.
+    // it has no ext-workspace handle and posts no events, and the swap is undone before anything gets to see it.
+    const auto ACTIVEWORKSPACE = PMONITOR->activeWorkspace;
+    const auto PWORKSPACE      = g_pCompositor->m_vWorkspaces.emplace_back(std::make_unique<CWorkspace>(PMONITOR->ID, "layoutbench", false, true)).get();
+    PWORKSPACE->m_iID          = g_pCompositor->getNextAvailableNamedWorkspace();
+    PWORKSPACE->m_iMonitorID   = PMONITOR->ID;
+    PMONITOR->activeWorkspace  = PWORKSPACE->m_iID;
+
+    // mapped tiled windows without a surface, XWaylandManager skips the configures and size hints for them
+    std::vector<CWindow*> mocks;
+    for (int i = 0; i < windows; ++i) {
+        const auto PWINDOW      = g_pCompositor->m_vWindows.emplace_back(std::make_unique<CWindow>()).get();
+        PWINDOW->m_uSurface.xdg = nullptr;
+        PWINDOW->m_iMonitorID   = PMONITOR->ID;
+        PWINDOW->m_iWorkspaceID = PWORKSPACE->m_iID;
+        PWINDOW->m_bIsMapped    = true;
+        PWINDOW->m_szTitle      = "layoutbench";
+        mocks.push_back(PWINDOW);
+    }
+
+    // us per op, and operator new calls per op when they're counted
+    auto measure = [&](int count, const std::function<void(int)>& fn) {
+#ifdef HYPRLAND_COUNT_ALLOCATIONS
+        const auto ALLOCS = Allocations::threadCount();
+#endif
+        const auto BEGIN = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < count; ++i)
+            fn(i);
+        const float US = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - BEGIN).count() / 1000.f / count;
+#ifdef HYPRLAND_COUNT_ALLOCATIONS
+        return getFormat("%.1fus, %.1f allocs", US, (Allocations::threadCount() - ALLOCS) / (float)count);
+#else
+        return getFormat("%.1fus", US);
+#endif
+    };
+
+    std::string result = getFormat("%i windows on %s (%ix%i), %i iterations\n", windows, PMONITOR->szName.c_str(), (int)PMONITOR->vecSize.x, (int)PMONITOR->vecSize.y, iterations);
+
+    // dwindle toggles a split back every second message and master cycles through its 5 orientations, both end where they started
+    struct SLayoutBench {
+        IHyprLayout* layout;
+        std::string  message;
+        int          messageRepeats;
+    };
+
+    const std::vector<SLayoutBench> LAYOUTS = {{&m_cDwindleLayout, "togglesplit", 2}, {&m_cMasterLayout, "orientationnext", 5}};
+
+    for (auto& b : LAYOUTS) {
+        const auto CREATED = measure(windows, [&](int i) { b.layout->onWindowCreatedTiling(mocks[i]); });
+        const auto RECALC  = measure(iterations, [&](int) { b.layout->recalculateMonitor(PMONITOR->ID); });
+        // grow and shrink the same window in turns
+        const auto RESIZED  = measure(iterations * 2, [&](int i) { b.layout->resizeActiveWindow(Vector2D(i % 2 ? -10 : 10, i % 2 ? -10 : 10), mocks[i / 2 % windows]); });
+        const auto SWITCHED = measure(iterations, [&](int i) { b.layout->switchWindows(mocks[i % windows], mocks[(i + 1) % windows]); });
+        const auto MESSAGED = measure(iterations * b.messageRepeats, [&](int i) { b.layout->layoutMessage({mocks[i / b.messageRepeats % windows]}, b.message); });
+        const auto REMOVED  = measure(windows, [&](int i) { b.layout->onWindowRemovedTiling(mocks[i]); });
+
+        result += getFormat("\t%s:\n\t\tonWindowCreatedTiling: %s\n\t\trecalculateMonitor: %s\n\t\tresizeActiveWindow: %s\n\t\tswitchWindows: %s\n\t\tlayoutMessage %s: "
+                            "%s\n\t\tonWindowRemovedTiling: %s\n",
+                            b.layout->getLayoutName().c_str(), CREATED.c_str(), RECALC.c_str(), RESIZED.c_str(), SWITCHED.c_str(), b.message.c_str(), MESSAGED.c_str(), REMOVED.c_str());
+    }
+
+    // unmapped first so ~CWindow doesn't look them up as the focused window
+    for (auto& w : mocks)
+        w->m_bIsMapped = false;
+
+    std::erase_if(g_pCompositor->m_vWindows, [&](const auto& w) { return std::find(mocks.begin(), mocks.end(), w.get()) != mocks.end(); });
+
+    // the id is handed out again to the next named workspace, it mustn't inherit master's orientation
+    std::erase_if(m_cMasterLayout.m_lMasterWorkspacesData, [&](const auto& other) { return other.workspaceID == PWORKSPACE->m_iID; });
+
+    PMONITOR->activeWorkspace = ACTIVEWORKSPACE;
+    std::erase_if(g_pCompositor->m_vWorkspaces, [&](const auto& ws) { return ws.get() == PWORKSPACE; });
+
+    g_pHyprRenderer->damageMonitor(PMONITOR);
+
+    return result;
+}
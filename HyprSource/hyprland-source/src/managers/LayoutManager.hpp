@@ -3,6 +3,9 @@
 #include "../layout/DwindleLayout.hpp"
 #include "../layout/MasterLayout.hpp"
 
+#define LAYOUTBENCH_MAX_ITERATIONS 1000
+#define LAYOUTBENCH_MAX_WINDOWS    1000
+
 class CLayoutManager {
   public:
     CLayoutManager();
@@ -14,6 +17,9 @@ class CLayoutManager {
     bool         addLayout(const std::string& name, IHyprLayout* layout);
     bool         removeLayout(IHyprLayout* layout);
 
+    // times dwindle and master on surfaceless mock windows, for hyprctl layoutbench. args are clamped to the limits below.
+    std::string  benchmarkLayouts(int iterations, int windows);
+
   private:
     enum HYPRLAYOUTS
     {
@@ -7,7 +7,7 @@ int slowUpdate = 0;
 int handleTimer(void* data) {
     const auto         PTM = (CThreadManager*)data;
 
-    static auto* const PDISABLECFGRELOAD = &g_pConfigManager->getConfigValuePtr("misc:disable_autoreload")->intValue;
+    static auto* const PDISABLECFGRELOAD = &g_pConfigManager->getConfigValuePtr(CFG_MISC_DISABLE_AUTORELOAD)->intValue;
 
     if (*PDISABLECFGRELOAD != 1)
         g_pConfigManager->tick();
@@ -20,6 +20,10 @@ int handleTimer(void* data) {
 CThreadManager::CThreadManager() {
     HyprCtl::startHyprCtlSocket();
 
+    // the config manager reloads on inotify events by itself, only poll if that's not available
+    if (g_pConfigManager->isWatchingConfig())
+        return;
+
     m_esConfigTimer = wl_event_loop_add_timer(g_pCompositor->m_sWLEventLoop, handleTimer, this);
 
     wl_event_source_timer_update(m_esConfigTimer, 1000);
@@ -9,7 +9,7 @@ class CThreadManager {
     CThreadManager();
     ~CThreadManager();
 
-    wl_event_source* m_esConfigTimer;
+    wl_event_source* m_esConfigTimer = nullptr;
 
   private:
 };
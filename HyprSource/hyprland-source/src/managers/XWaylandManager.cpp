@@ -148,6 +148,10 @@ void CHyprXWaylandManager::setWindowSize(CWindow* pWindow, Vector2D size, bool f
     pWindow->m_vReportedPosition = pWindow->m_vRealPosition.vec();
     pWindow->m_vReportedSize     = size;
 
+    // surfaceless windows from hyprctl layoutbench
+    if (!pWindow->m_uSurface.xdg)
+        return;
+
     if (pWindow->m_bIsX11)
         wlr_xwayland_surface_configure(pWindow->m_uSurface.xwayland, pWindow->m_vRealPosition.vec().x, pWindow->m_vRealPosition.vec().y, size.x, size.y);
     else
@@ -266,7 +270,7 @@ Vector2D CHyprXWaylandManager::getMaxSizeForWindow(CWindow* pWindow) {
     if (!g_pCompositor->windowValidMapped(pWindow))
         return Vector2D(99999, 99999);
 
-    if ((pWindow->m_bIsX11 && !pWindow->m_uSurface.xwayland->size_hints) || (!pWindow->m_bIsX11 && !pWindow->m_uSurface.xdg->toplevel) ||
+    if (!pWindow->m_uSurface.xdg || (pWindow->m_bIsX11 && !pWindow->m_uSurface.xwayland->size_hints) || (!pWindow->m_bIsX11 && !pWindow->m_uSurface.xdg->toplevel) ||
         pWindow->m_sAdditionalConfigData.noMaxSize)
         return Vector2D(99999, 99999);
 
@@ -4,12 +4,14 @@
 #include <ranges>
 
 void CInputManager::onMouseMoved(wlr_pointer_motion_event* e) {
-    static auto* const PSENS      = &g_pConfigManager->getConfigValuePtr("general:sensitivity")->floatValue;
-    static auto* const PNOACCEL   = &g_pConfigManager->getConfigValuePtr("input:force_no_accel")->intValue;
-    static auto* const PSENSTORAW = &g_pConfigManager->getConfigValuePtr("general:apply_sens_to_raw")->intValue;
+    static auto* const PSENS      = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_SENSITIVITY)->floatValue;
+    static auto* const PNOACCEL   = &g_pConfigManager->getConfigValuePtr(CFG_INPUT_FORCE_NO_ACCEL)->intValue;
+    static auto* const PSENSTORAW = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_APPLY_SENS_TO_RAW)->intValue;
 
     const auto         DELTA = *PNOACCEL == 1 ? Vector2D(e->unaccel_dx, e->unaccel_dy) : Vector2D(e->delta_x, e->delta_y);
 
+    markInputEvent(e->time_msec);
+
     if (*PSENSTORAW == 1)
         wlr_relative_pointer_manager_v1_send_relative_motion(g_pCompositor->m_sWLRRelPointerMgr, g_pCompositor->m_sSeat.seat, (uint64_t)e->time_msec * 1000, DELTA.x * *PSENS,
                                                              DELTA.y * *PSENS, e->unaccel_dx * *PSENS, e->unaccel_dy * *PSENS);
@@ -19,7 +21,7 @@ void CInputManager::onMouseMoved(wlr_pointer_motion_event* e) {
 
     wlr_cursor_move(g_pCompositor->m_sWLRCursor, &e->pointer->base, DELTA.x * *PSENS, DELTA.y * *PSENS);
 
-    mouseMoveUnified(e->time_msec);
+    queueMouseMove(e->time_msec);
 
     m_tmrLastCursorMovement.reset();
 
@@ -27,9 +29,11 @@ void CInputManager::onMouseMoved(wlr_pointer_motion_event* e) {
 }
 
 void CInputManager::onMouseWarp(wlr_pointer_motion_absolute_event* e) {
+    markInputEvent(e->time_msec);
+
     wlr_cursor_warp_absolute(g_pCompositor->m_sWLRCursor, &e->pointer->base, e->x, e->y);
 
-    mouseMoveUnified(e->time_msec);
+    queueMouseMove(e->time_msec);
 
     m_tmrLastCursorMovement.reset();
 
@@ -45,17 +49,98 @@ void CInputManager::simulateMouseMovement() {
     m_tmrLastCursorMovement.reset();
 }
 
+void CInputManager::queueMouseMove(uint32_t time) {
+    static auto* const PCOALESCE = &g_pConfigManager->getConfigValuePtr(CFG_INPUT_COALESCE_MOTION)->intValue;
+
+    // constrained pointers have to be warped back right away, and with dpms off there won't be a frame to resolve on
+    if (!*PCOALESCE || !g_pCompositor->m_bDPMSStateON || !g_pCompositor->m_pLastMonitor ||
+        (g_pCompositor->m_sSeat.mouse && g_pCompositor->m_sSeat.mouse->currentConstraint)) {
+        mouseMoveUnified(time);
+        return;
+    }
+
+    // the cursor itself already moved and the focused surface still gets every sample, only the hit testing and refocus wait for the next frame
+    if (m_pMotionSurface && m_pMotionSurface == g_pCompositor->m_sSeat.seat->pointer_state.focused_surface &&
+        (!m_pMotionWindow || g_pCompositor->windowValidMapped(m_pMotionWindow)) && (!m_pMotionLayerSurface || m_pMotionLayerSurface->mapped)) {
+        const auto LOCAL = getMouseCoordsInternal() - getMotionOwnerPosition() - m_vMotionSurfaceOffset;
+        wlr_seat_pointer_notify_motion(g_pCompositor->m_sSeat.seat, time, LOCAL.x, LOCAL.y);
+    }
+
+    m_uPendingMouseMoveTime = time;
+
+    if (m_bPendingMouseMove)
+        return;
+
+    m_bPendingMouseMove = true;
+
+    g_pCompositor->scheduleFrameForMonitor(g_pCompositor->m_pLastMonitor);
+}
+
+Vector2D CInputManager::getMotionOwnerPosition() {
+    if (m_pMotionWindow)
+        return m_pMotionWindow->m_vRealPosition.vec();
+
+    if (m_pMotionLayerSurface)
+        return Vector2D(m_pMotionLayerSurface->geometry.x, m_pMotionLayerSurface->geometry.y);
+
+    return Vector2D();
+}
+
+void CInputManager::setMotionSurface(wlr_surface* pSurface, CWindow* pWindow, SLayerSurface* pLayerSurface, const Vector2D& origin) {
+    m_pMotionSurface       = pSurface;
+    m_pMotionWindow        = pWindow;
+    m_pMotionLayerSurface  = pWindow ? nullptr : pLayerSurface;
+    m_vMotionSurfaceOffset = origin - getMotionOwnerPosition();
+}
+
+void CInputManager::onPointerFocusChange(wlr_seat_pointer_focus_change_event* e) {
+    // mouseMoveUnified sets it again after its own enters, anything else (focusWindow, a destroyed surface...) makes it stale
+    if (e->new_surface == m_pMotionSurface)
+        return;
+
+    m_pMotionSurface      = nullptr;
+    m_pMotionWindow       = nullptr;
+    m_pMotionLayerSurface = nullptr;
+}
+
+void CInputManager::markInputEvent(uint32_t timeMsec) {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    const uint64_t NOWNS = (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+
+    // device timestamps are CLOCK_MONOTONIC ms cut to 32 bits, the wrapping difference gives the age
+    const uint32_t AGEMS = (uint32_t)(NOWNS / 1000000ULL) - timeMsec;
+
+    m_sLatestInput.serial++;
+
+    // virtual devices send whatever they like, use the time we got it then
+    m_sLatestInput.time = AGEMS < 1000 ? NOWNS - AGEMS * 1000000ULL : NOWNS;
+}
+
+void CInputManager::flushPendingMouseMove() {
+    if (!m_bPendingMouseMove)
+        return;
+
+    mouseMoveUnified(m_uPendingMouseMoveTime);
+}
+
 void CInputManager::mouseMoveUnified(uint32_t time, bool refocus) {
-    static auto* const PFOLLOWMOUSE      = &g_pConfigManager->getConfigValuePtr("input:follow_mouse")->intValue;
-    static auto* const PMOUSEDPMS        = &g_pConfigManager->getConfigValuePtr("misc:mouse_move_enables_dpms")->intValue;
-    static auto* const PFOLLOWONDND      = &g_pConfigManager->getConfigValuePtr("misc:always_follow_on_dnd")->intValue;
-    static auto* const PHOGFOCUS         = &g_pConfigManager->getConfigValuePtr("misc:layers_hog_keyboard_focus")->intValue;
-    static auto* const PFLOATBEHAVIOR    = &g_pConfigManager->getConfigValuePtr("input:float_switch_override_focus")->intValue;
-    static auto* const PMOUSEFOCUSMON    = &g_pConfigManager->getConfigValuePtr("misc:mouse_move_focuses_monitor")->intValue;
-    static auto* const PRESIZEONBORDER   = &g_pConfigManager->getConfigValuePtr("general:resize_on_border")->intValue;
-    static auto* const PBORDERSIZE       = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
-    static auto* const PBORDERGRABEXTEND = &g_pConfigManager->getConfigValuePtr("general:extend_border_grab_area")->intValue;
-    static auto* const PRESIZECURSORICON = &g_pConfigManager->getConfigValuePtr("general:hover_icon_on_border")->intValue;
+    TRACE_SCOPE("input", "mouseMove");
+
+    // anything queued is resolved by this call
+    m_bPendingMouseMove = false;
+
+    static auto* const PFOLLOWMOUSE      = &g_pConfigManager->getConfigValuePtr(CFG_INPUT_FOLLOW_MOUSE)->intValue;
+    static auto* const PMOUSEDPMS        = &g_pConfigManager->getConfigValuePtr(CFG_MISC_MOUSE_MOVE_ENABLES_DPMS)->intValue;
+    static auto* const PFOLLOWONDND      = &g_pConfigManager->getConfigValuePtr(CFG_MISC_ALWAYS_FOLLOW_ON_DND)->intValue;
+    static auto* const PHOGFOCUS         = &g_pConfigManager->getConfigValuePtr(CFG_MISC_LAYERS_HOG_KEYBOARD_FOCUS)->intValue;
+    static auto* const PFLOATBEHAVIOR    = &g_pConfigManager->getConfigValuePtr(CFG_INPUT_FLOAT_SWITCH_OVERRIDE_FOCUS)->intValue;
+    static auto* const PMOUSEFOCUSMON    = &g_pConfigManager->getConfigValuePtr(CFG_MISC_MOUSE_MOVE_FOCUSES_MONITOR)->intValue;
+    static auto* const PRESIZEONBORDER   = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_RESIZE_ON_BORDER)->intValue;
+    static auto* const PBORDERSIZE       = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
+    static auto* const PBORDERGRABEXTEND = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_EXTEND_BORDER_GRAB_AREA)->intValue;
+    static auto* const PRESIZECURSORICON = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_HOVER_ICON_ON_BORDER)->intValue;
     const auto         BORDER_GRAB_AREA  = *PRESIZEONBORDER ? *PBORDERSIZE + *PBORDERGRABEXTEND : 0;
 
     const auto         FOLLOWMOUSE = *PFOLLOWONDND && m_sDrag.drag ? 1 : *PFOLLOWMOUSE;
@@ -86,6 +171,9 @@ void CInputManager::mouseMoveUnified(uint32_t time, bool refocus) {
     EMIT_HOOK_EVENT("mouseMove", MOUSECOORDSFLOORED);
 
     m_vLastCursorPosFloored = MOUSECOORDSFLOORED;
+    m_pMotionSurface        = nullptr;
+    m_pMotionWindow         = nullptr;
+    m_pMotionLayerSurface   = nullptr;
 
     const auto PMONITOR = g_pCompositor->getMonitorFromCursor();
 
@@ -368,8 +456,10 @@ void CInputManager::mouseMoveUnified(uint32_t time, bool refocus) {
                 }
             }
 
-            if (FOLLOWMOUSE != 0 || pFoundWindow == g_pCompositor->m_pLastWindow)
+            if (FOLLOWMOUSE != 0 || pFoundWindow == g_pCompositor->m_pLastWindow) {
                 wlr_seat_pointer_notify_motion(g_pCompositor->m_sSeat.seat, time, surfaceLocal.x, surfaceLocal.y);
+                setMotionSurface(foundSurface, pFoundWindow, pFoundLayerSurface, mouseCoords - surfaceLocal);
+            }
 
             m_bLastFocusOnLS = false;
             return; // don't enter any new surfaces
@@ -396,9 +486,16 @@ void CInputManager::mouseMoveUnified(uint32_t time, bool refocus) {
 
     wlr_seat_pointer_notify_enter(g_pCompositor->m_sSeat.seat, foundSurface, surfaceLocal.x, surfaceLocal.y);
     wlr_seat_pointer_notify_motion(g_pCompositor->m_sSeat.seat, time, surfaceLocal.x, surfaceLocal.y);
+
+    setMotionSurface(foundSurface, pFoundWindow, pFoundLayerSurface, mouseCoords - surfaceLocal);
 }
 
 void CInputManager::onMouseButton(wlr_pointer_button_event* e) {
+    TRACE_SCOPE("input", "mouseButton");
+
+    markInputEvent(e->time_msec);
+    flushPendingMouseMove();
+
     wlr_idle_notify_activity(g_pCompositor->m_sWLRIdle, g_pCompositor->m_sSeat.seat);
 
     EMIT_HOOK_EVENT("mouseButton", e);
@@ -492,10 +589,10 @@ void CInputManager::setClickMode(eClickBehaviorMode mode) {
 void CInputManager::processMouseDownNormal(wlr_pointer_button_event* e) {
 
     // notify the keybind manager
-    static auto* const PPASSMOUSE      = &g_pConfigManager->getConfigValuePtr("binds:pass_mouse_when_bound")->intValue;
+    static auto* const PPASSMOUSE      = &g_pConfigManager->getConfigValuePtr(CFG_BINDS_PASS_MOUSE_WHEN_BOUND)->intValue;
     const auto         PASS            = g_pKeybindManager->onMouseEvent(e);
-    static auto* const PFOLLOWMOUSE    = &g_pConfigManager->getConfigValuePtr("input:follow_mouse")->intValue;
-    static auto* const PRESIZEONBORDER = &g_pConfigManager->getConfigValuePtr("general:resize_on_border")->intValue;
+    static auto* const PFOLLOWMOUSE    = &g_pConfigManager->getConfigValuePtr(CFG_INPUT_FOLLOW_MOUSE)->intValue;
+    static auto* const PRESIZEONBORDER = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_RESIZE_ON_BORDER)->intValue;
 
     if (!PASS && !*PPASSMOUSE)
         return;
@@ -568,10 +665,13 @@ void CInputManager::processMouseDownKill(wlr_pointer_button_event* e) {
 }
 
 void CInputManager::onMouseWheel(wlr_pointer_axis_event* e) {
-    static auto* const PSCROLLFACTOR = &g_pConfigManager->getConfigValuePtr("input:touchpad:scroll_factor")->floatValue;
+    static auto* const PSCROLLFACTOR = &g_pConfigManager->getConfigValuePtr(CFG_INPUT_TOUCHPAD_SCROLL_FACTOR)->floatValue;
 
     auto               factor = (*PSCROLLFACTOR <= 0.f || e->source != WLR_AXIS_SOURCE_FINGER ? 1.f : *PSCROLLFACTOR);
 
+    markInputEvent(e->time_msec);
+    flushPendingMouseMove();
+
     bool               passEvent = g_pKeybindManager->onAxisEvent(e);
 
     wlr_idle_notify_activity(g_pCompositor->m_sWLRIdle, g_pCompositor->m_sSeat.seat);
@@ -682,17 +782,17 @@ void CInputManager::applyConfigToKeyboard(SKeyboard* pKeyboard) {
     if (!wlr_keyboard_from_input_device(pKeyboard->keyboard))
         return;
 
-    const auto REPEATRATE  = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "repeat_rate") : g_pConfigManager->getInt("input:repeat_rate");
-    const auto REPEATDELAY = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "repeat_delay") : g_pConfigManager->getInt("input:repeat_delay");
+    const auto REPEATRATE  = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "repeat_rate") : g_pConfigManager->getInt(CFG_INPUT_REPEAT_RATE);
+    const auto REPEATDELAY = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "repeat_delay") : g_pConfigManager->getInt(CFG_INPUT_REPEAT_DELAY);
 
-    const auto NUMLOCKON = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "numlock_by_default") : g_pConfigManager->getInt("input:numlock_by_default");
+    const auto NUMLOCKON = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "numlock_by_default") : g_pConfigManager->getInt(CFG_INPUT_NUMLOCK_BY_DEFAULT);
 
-    const auto FILEPATH = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_file") : g_pConfigManager->getString("input:kb_file");
-    const auto RULES    = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_rules") : g_pConfigManager->getString("input:kb_rules");
-    const auto MODEL    = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_model") : g_pConfigManager->getString("input:kb_model");
-    const auto LAYOUT   = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_layout") : g_pConfigManager->getString("input:kb_layout");
-    const auto VARIANT  = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_variant") : g_pConfigManager->getString("input:kb_variant");
-    const auto OPTIONS  = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_options") : g_pConfigManager->getString("input:kb_options");
+    const auto FILEPATH = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_file") : g_pConfigManager->getString(CFG_INPUT_KB_FILE);
+    const auto RULES    = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_rules") : g_pConfigManager->getString(CFG_INPUT_KB_RULES);
+    const auto MODEL    = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_model") : g_pConfigManager->getString(CFG_INPUT_KB_MODEL);
+    const auto LAYOUT   = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_layout") : g_pConfigManager->getString(CFG_INPUT_KB_LAYOUT);
+    const auto VARIANT  = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_variant") : g_pConfigManager->getString(CFG_INPUT_KB_VARIANT);
+    const auto OPTIONS  = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "kb_options") : g_pConfigManager->getString(CFG_INPUT_KB_OPTIONS);
 
     const auto ENABLED = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "enabled") : true;
 
@@ -852,24 +952,24 @@ void CInputManager::setPointerConfigs() {
         if (wlr_input_device_is_libinput(m.mouse)) {
             const auto LIBINPUTDEV = (libinput_device*)wlr_libinput_get_device_handle(m.mouse);
 
-            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "clickfinger_behavior") : g_pConfigManager->getInt("input:touchpad:clickfinger_behavior")) ==
+            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "clickfinger_behavior", "touchpad") : g_pConfigManager->getInt(CFG_INPUT_TOUCHPAD_CLICKFINGER_BEHAVIOR)) ==
                 0) // toggle software buttons or clickfinger
                 libinput_device_config_click_set_method(LIBINPUTDEV, LIBINPUT_CONFIG_CLICK_METHOD_BUTTON_AREAS);
             else
                 libinput_device_config_click_set_method(LIBINPUTDEV, LIBINPUT_CONFIG_CLICK_METHOD_CLICKFINGER);
 
-            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "left_handed") : g_pConfigManager->getInt("input:left_handed")) == 0)
+            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "left_handed") : g_pConfigManager->getInt(CFG_INPUT_LEFT_HANDED)) == 0)
                 libinput_device_config_left_handed_set(LIBINPUTDEV, 0);
             else
                 libinput_device_config_left_handed_set(LIBINPUTDEV, 1);
 
             if (libinput_device_config_middle_emulation_is_available(LIBINPUTDEV)) { // middleclick on r+l mouse button pressed
-                if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "middle_button_emulation") : g_pConfigManager->getInt("input:touchpad:middle_button_emulation")) == 1)
+                if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "middle_button_emulation", "touchpad") : g_pConfigManager->getInt(CFG_INPUT_TOUCHPAD_MIDDLE_BUTTON_EMULATION)) == 1)
                     libinput_device_config_middle_emulation_set_enabled(LIBINPUTDEV, LIBINPUT_CONFIG_MIDDLE_EMULATION_ENABLED);
                 else
                     libinput_device_config_middle_emulation_set_enabled(LIBINPUTDEV, LIBINPUT_CONFIG_MIDDLE_EMULATION_DISABLED);
 
-                const auto TAP_MAP = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "tap_button_map") : g_pConfigManager->getString("input:touchpad:tap_button_map");
+                const auto TAP_MAP = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "tap_button_map", "touchpad") : g_pConfigManager->getString(CFG_INPUT_TOUCHPAD_TAP_BUTTON_MAP);
                 if (TAP_MAP == "" || TAP_MAP == "lrm")
                     libinput_device_config_tap_set_button_map(LIBINPUTDEV, LIBINPUT_CONFIG_TAP_MAP_LRM);
                 else if (TAP_MAP == "lmr")
@@ -878,7 +978,7 @@ void CInputManager::setPointerConfigs() {
                     Debug::log(WARN, "Tap button mapping unknown");
             }
 
-            const auto SCROLLMETHOD = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "scroll_method") : g_pConfigManager->getString("input:scroll_method");
+            const auto SCROLLMETHOD = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "scroll_method") : g_pConfigManager->getString(CFG_INPUT_SCROLL_METHOD);
             if (SCROLLMETHOD == "") {
                 libinput_device_config_scroll_set_method(LIBINPUTDEV, libinput_device_config_scroll_get_default_method(LIBINPUTDEV));
             } else if (SCROLLMETHOD == "no_scroll") {
@@ -893,18 +993,18 @@ void CInputManager::setPointerConfigs() {
                 Debug::log(WARN, "Scroll method unknown");
             }
 
-            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "tap-and-drag") : g_pConfigManager->getInt("input:touchpad:tap-and-drag")) == 0)
+            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "tap-and-drag", "touchpad") : g_pConfigManager->getInt(CFG_INPUT_TOUCHPAD_TAP_AND_DRAG)) == 0)
                 libinput_device_config_tap_set_drag_enabled(LIBINPUTDEV, LIBINPUT_CONFIG_DRAG_DISABLED);
             else
                 libinput_device_config_tap_set_drag_enabled(LIBINPUTDEV, LIBINPUT_CONFIG_DRAG_ENABLED);
 
-            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "drag_lock") : g_pConfigManager->getInt("input:touchpad:drag_lock")) == 0)
+            if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "drag_lock", "touchpad") : g_pConfigManager->getInt(CFG_INPUT_TOUCHPAD_DRAG_LOCK)) == 0)
                 libinput_device_config_tap_set_drag_lock_enabled(LIBINPUTDEV, LIBINPUT_CONFIG_DRAG_LOCK_DISABLED);
             else
                 libinput_device_config_tap_set_drag_lock_enabled(LIBINPUTDEV, LIBINPUT_CONFIG_DRAG_LOCK_ENABLED);
 
             if (libinput_device_config_tap_get_finger_count(LIBINPUTDEV)) // this is for tapping (like on a laptop)
-                if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "tap-to-click") : g_pConfigManager->getInt("input:touchpad:tap-to-click")) == 1)
+                if ((HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "tap-to-click", "touchpad") : g_pConfigManager->getInt(CFG_INPUT_TOUCHPAD_TAP_TO_CLICK)) == 1)
                     libinput_device_config_tap_set_enabled(LIBINPUTDEV, LIBINPUT_CONFIG_TAP_ENABLED);
 
             if (libinput_device_config_scroll_has_natural_scroll(LIBINPUTDEV)) {
@@ -913,23 +1013,23 @@ void CInputManager::setPointerConfigs() {
                 if (libinput_device_has_capability(LIBINPUTDEV, LIBINPUT_DEVICE_CAP_POINTER) &&
                     libinput_device_get_size(LIBINPUTDEV, &w, &h) == 0) // pointer with size is a touchpad
                     libinput_device_config_scroll_set_natural_scroll_enabled(
-                        LIBINPUTDEV, (HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "natural_scroll") : g_pConfigManager->getInt("input:touchpad:natural_scroll")));
+                        LIBINPUTDEV, (HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "natural_scroll", "touchpad") : g_pConfigManager->getInt(CFG_INPUT_TOUCHPAD_NATURAL_SCROLL)));
                 else
                     libinput_device_config_scroll_set_natural_scroll_enabled(
-                        LIBINPUTDEV, (HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "natural_scroll") : g_pConfigManager->getInt("input:natural_scroll")));
+                        LIBINPUTDEV, (HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "natural_scroll") : g_pConfigManager->getInt(CFG_INPUT_NATURAL_SCROLL)));
             }
 
             if (libinput_device_config_dwt_is_available(LIBINPUTDEV)) {
                 const auto DWT = static_cast<enum libinput_config_dwt_state>(
-                    (HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "disable_while_typing") : g_pConfigManager->getInt("input:touchpad:disable_while_typing")) != 0);
+                    (HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "disable_while_typing", "touchpad") : g_pConfigManager->getInt(CFG_INPUT_TOUCHPAD_DISABLE_WHILE_TYPING)) != 0);
                 libinput_device_config_dwt_set_enabled(LIBINPUTDEV, DWT);
             }
 
             const auto LIBINPUTSENS =
-                std::clamp((HASCONFIG ? g_pConfigManager->getDeviceFloat(devname, "sensitivity") : g_pConfigManager->getFloat("input:sensitivity")), -1.f, 1.f);
+                std::clamp((HASCONFIG ? g_pConfigManager->getDeviceFloat(devname, "sensitivity") : g_pConfigManager->getFloat(CFG_INPUT_SENSITIVITY)), -1.f, 1.f);
             libinput_device_config_accel_set_speed(LIBINPUTDEV, LIBINPUTSENS);
 
-            const auto ACCELPROFILE = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "accel_profile") : g_pConfigManager->getString("input:accel_profile");
+            const auto ACCELPROFILE = HASCONFIG ? g_pConfigManager->getDeviceString(devname, "accel_profile") : g_pConfigManager->getString(CFG_INPUT_ACCEL_PROFILE);
 
             if (ACCELPROFILE == "") {
                 libinput_device_config_accel_set_profile(LIBINPUTDEV, libinput_device_config_accel_get_default_profile(LIBINPUTDEV));
@@ -941,7 +1041,7 @@ void CInputManager::setPointerConfigs() {
                 Debug::log(WARN, "Unknown acceleration profile, falling back to default");
             }
 
-            const auto SCROLLBUTTON = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "scroll_button") : g_pConfigManager->getInt("input:scroll_button");
+            const auto SCROLLBUTTON = HASCONFIG ? g_pConfigManager->getDeviceInt(devname, "scroll_button") : g_pConfigManager->getInt(CFG_INPUT_SCROLL_BUTTON);
 
             libinput_device_config_scroll_set_button(LIBINPUTDEV, SCROLLBUTTON == 0 ? libinput_device_config_scroll_get_default_button(LIBINPUTDEV) : SCROLLBUTTON);
 
@@ -955,6 +1055,8 @@ void CInputManager::destroyKeyboard(SKeyboard* pKeyboard) {
     pKeyboard->hyprListener_keyboardMod.removeCallback();
     pKeyboard->hyprListener_keyboardKey.removeCallback();
 
+    HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
+
     if (pKeyboard->active) {
         m_lKeyboards.remove(*pKeyboard);
 
@@ -969,6 +1071,8 @@ void CInputManager::destroyKeyboard(SKeyboard* pKeyboard) {
 }
 
 void CInputManager::destroyMouse(wlr_input_device* mouse) {
+    HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
+
     for (auto& m : m_lMice) {
         if (m.mouse == mouse) {
             m_lMice.remove(m);
@@ -1005,15 +1109,20 @@ void CInputManager::updateKeyboardsLeds(wlr_input_device* pKeyboard) {
 }
 
 void CInputManager::onKeyboardKey(wlr_keyboard_key_event* e, SKeyboard* pKeyboard) {
+    TRACE_SCOPE("input", "keyboardKey");
+
     if (!pKeyboard->enabled)
         return;
 
-    static auto* const PDPMS = &g_pConfigManager->getConfigValuePtr("misc:key_press_enables_dpms")->intValue;
+    static auto* const PDPMS = &g_pConfigManager->getConfigValuePtr(CFG_MISC_KEY_PRESS_ENABLES_DPMS)->intValue;
     if (*PDPMS && !g_pCompositor->m_bDPMSStateON) {
         // enable dpms
         g_pKeybindManager->dpms("on");
     }
 
+    markInputEvent(e->time_msec);
+    flushPendingMouseMove();
+
     bool passEvent = g_pKeybindManager->onKeyEvent(e, pKeyboard);
 
     wlr_idle_notify_activity(g_pCompositor->m_sWLRIdle, g_pCompositor->m_sSeat.seat);
@@ -1297,10 +1406,10 @@ void CInputManager::setTouchDeviceConfigs() {
             const auto LIBINPUTDEV = (libinput_device*)wlr_libinput_get_device_handle(m.pWlrDevice);
 
             const int  ROTATION =
-                std::clamp(HASCONFIG ? g_pConfigManager->getDeviceInt(PTOUCHDEV->name, "transform") : g_pConfigManager->getInt("input:touchdevice:transform"), 0, 7);
+                std::clamp(HASCONFIG ? g_pConfigManager->getDeviceInt(PTOUCHDEV->name, "transform", "touchdevice") : g_pConfigManager->getInt(CFG_INPUT_TOUCHDEVICE_TRANSFORM), 0, 7);
             libinput_device_config_calibration_set_matrix(LIBINPUTDEV, MATRICES[ROTATION]);
 
-            const auto OUTPUT = HASCONFIG ? g_pConfigManager->getDeviceString(PTOUCHDEV->name, "output") : g_pConfigManager->getString("input:touchdevice:output");
+            const auto OUTPUT = HASCONFIG ? g_pConfigManager->getDeviceString(PTOUCHDEV->name, "output", "touchdevice") : g_pConfigManager->getString(CFG_INPUT_TOUCHDEVICE_OUTPUT);
             if (!OUTPUT.empty() && OUTPUT != STRVAL_EMPTY)
                 PTOUCHDEV->boundOutput = OUTPUT;
             else
@@ -1316,11 +1425,11 @@ void CInputManager::setTabletConfigs() {
         if (wlr_input_device_is_libinput(t.wlrDevice)) {
             const auto LIBINPUTDEV = (libinput_device*)wlr_libinput_get_device_handle(t.wlrDevice);
 
-            const int  ROTATION = std::clamp(HASCONFIG ? g_pConfigManager->getDeviceInt(t.name, "transform") : g_pConfigManager->getInt("input:tablet:transform"), 0, 7);
+            const int  ROTATION = std::clamp(HASCONFIG ? g_pConfigManager->getDeviceInt(t.name, "transform", "tablet") : g_pConfigManager->getInt(CFG_INPUT_TABLET_TRANSFORM), 0, 7);
             Debug::log(LOG, "Setting calibration matrix for device %s", t.name.c_str());
             libinput_device_config_calibration_set_matrix(LIBINPUTDEV, MATRICES[ROTATION]);
 
-            const auto OUTPUT   = HASCONFIG ? g_pConfigManager->getDeviceString(t.name, "output") : g_pConfigManager->getString("input:tablet:output");
+            const auto OUTPUT   = HASCONFIG ? g_pConfigManager->getDeviceString(t.name, "output", "tablet") : g_pConfigManager->getString(CFG_INPUT_TABLET_OUTPUT);
             const auto PMONITOR = g_pCompositor->getMonitorFromString(OUTPUT);
             if (!OUTPUT.empty() && OUTPUT != STRVAL_EMPTY && PMONITOR) {
                 wlr_cursor_map_input_to_output(g_pCompositor->m_sWLRCursor, t.wlrDevice, PMONITOR->output);
@@ -1334,6 +1443,8 @@ void CInputManager::destroyTouchDevice(STouchDevice* pDevice) {
     Debug::log(LOG, "Touch device at %x removed", pDevice);
 
     m_lTouchDevices.remove(*pDevice);
+
+    HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
 }
 
 void CInputManager::newSwitch(wlr_input_device* pDevice) {
@@ -1379,6 +1490,8 @@ void CInputManager::newSwitch(wlr_input_device* pDevice) {
 
 void CInputManager::destroySwitch(SSwitchDevice* pDevice) {
     m_lSwitches.remove(*pDevice);
+
+    HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
 }
 
 void CInputManager::setCursorImageUntilUnset(std::string name) {
@@ -1462,9 +1575,9 @@ void CInputManager::setCursorIconOnBorder(CWindow* w) {
         return;
     }
 
-    static auto* const PROUNDING         = &g_pConfigManager->getConfigValuePtr("decoration:rounding")->intValue;
-    static const auto* PBORDERSIZE       = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
-    static const auto* PEXTENDBORDERGRAB = &g_pConfigManager->getConfigValuePtr("general:extend_border_grab_area")->intValue;
+    static auto* const PROUNDING         = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ROUNDING)->intValue;
+    static const auto* PBORDERSIZE       = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
+    static const auto* PEXTENDBORDERGRAB = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_EXTEND_BORDER_GRAB_AREA)->intValue;
     // give a small leeway (10 px) for corner icon
     const auto           CORNER           = *PROUNDING + *PBORDERSIZE + 10;
     const auto           mouseCoords      = getMouseCoordsInternal();
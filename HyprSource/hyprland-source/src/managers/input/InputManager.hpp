@@ -5,6 +5,7 @@
 #include "../../helpers/WLClasses.hpp"
 #include "../../Window.hpp"
 #include "../../helpers/Timer.hpp"
+#include "../../helpers/FrameStats.hpp"
 #include "InputMethodRelay.hpp"
 
 enum eClickBehaviorMode
@@ -88,6 +89,11 @@ class CInputManager {
     Vector2D           getMouseCoordsInternal();
     void               refocus();
     void               simulateMouseMovement();
+    void               flushPendingMouseMove();
+
+    // tags the newest input event, monitors attribute their next damage to it for the input latency stats
+    void               markInputEvent(uint32_t timeMsec);
+    SInputMarker       m_sLatestInput;
 
     void               setKeyboardLayout();
     void               setPointerConfigs();
@@ -100,6 +106,7 @@ class CInputManager {
     void               setClickMode(eClickBehaviorMode);
     eClickBehaviorMode getClickMode();
     void               processMouseRequest(wlr_seat_pointer_request_set_cursor_event*);
+    void               onPointerFocusChange(wlr_seat_pointer_focus_change_event*);
 
     void               onTouchDown(wlr_touch_down_event*);
     void               onTouchUp(wlr_touch_up_event*);
@@ -192,6 +199,22 @@ class CInputManager {
     uint32_t           m_uiCapabilities = 0;
 
     void               mouseMoveUnified(uint32_t, bool refocus = false);
+    void               queueMouseMove(uint32_t);
+
+    // motion waiting for the next frame to be resolved, see queueMouseMove
+    bool               m_bPendingMouseMove     = false;
+    uint32_t           m_uPendingMouseMoveTime = 0;
+
+    // the surface the last resolution sent motion to, so queued motion still reaches it right away.
+    // its origin is kept relative to the window / layer it belongs to, which may move before the next frame.
+    // dropped whenever the pointer focus changes, see onPointerFocusChange
+    wlr_surface*       m_pMotionSurface      = nullptr;
+    CWindow*           m_pMotionWindow       = nullptr;
+    SLayerSurface*     m_pMotionLayerSurface = nullptr;
+    Vector2D           m_vMotionSurfaceOffset;
+
+    void               setMotionSurface(wlr_surface*, CWindow*, SLayerSurface*, const Vector2D& origin);
+    Vector2D           getMotionOwnerPosition();
 
     STabletTool*       ensureTabletToolPresent(wlr_tablet_tool*);
 
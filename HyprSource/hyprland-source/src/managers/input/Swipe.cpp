@@ -2,9 +2,9 @@
 #include "../../Compositor.hpp"
 
 void CInputManager::onSwipeBegin(wlr_pointer_swipe_begin_event* e) {
-    static auto* const PSWIPE        = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe")->intValue;
-    static auto* const PSWIPEFINGERS = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_fingers")->intValue;
-    static auto* const PSWIPENEW     = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_create_new")->intValue;
+    static auto* const PSWIPE        = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE)->intValue;
+    static auto* const PSWIPEFINGERS = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_FINGERS)->intValue;
+    static auto* const PSWIPENEW     = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_CREATE_NEW)->intValue;
 
     if (e->fingers != *PSWIPEFINGERS || *PSWIPE == 0 || g_pSessionLockManager->isSessionLocked())
         return;
@@ -44,11 +44,11 @@ void CInputManager::onSwipeEnd(wlr_pointer_swipe_end_event* e) {
     if (!m_sActiveSwipe.pWorkspaceBegin)
         return; // no valid swipe
 
-    static auto* const PSWIPEPERC   = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_cancel_ratio")->floatValue;
-    static auto* const PSWIPEDIST   = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_distance")->intValue;
-    static auto* const PSWIPEFORC   = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_min_speed_to_force")->intValue;
-    static auto* const PSWIPENEW    = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_create_new")->intValue;
-    static auto* const PSWIPENUMBER = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_numbered")->intValue;
+    static auto* const PSWIPEPERC   = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_CANCEL_RATIO)->floatValue;
+    static auto* const PSWIPEDIST   = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_DISTANCE)->intValue;
+    static auto* const PSWIPEFORC   = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_MIN_SPEED_TO_FORCE)->intValue;
+    static auto* const PSWIPENEW    = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_CREATE_NEW)->intValue;
+    static auto* const PSWIPENUMBER = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_NUMBERED)->intValue;
     const bool         VERTANIMS    = m_sActiveSwipe.pWorkspaceBegin->m_vRenderOffset.getConfig()->pValues->internalStyle == "slidevert";
 
     // commit
@@ -186,11 +186,11 @@ void CInputManager::onSwipeUpdate(wlr_pointer_swipe_update_event* e) {
     if (!m_sActiveSwipe.pWorkspaceBegin)
         return;
 
-    static auto* const PSWIPEDIST    = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_distance")->intValue;
-    static auto* const PSWIPEINVR    = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_invert")->intValue;
-    static auto* const PSWIPENEW     = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_create_new")->intValue;
-    static auto* const PSWIPEFOREVER = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_forever")->intValue;
-    static auto* const PSWIPENUMBER  = &g_pConfigManager->getConfigValuePtr("gestures:workspace_swipe_numbered")->intValue;
+    static auto* const PSWIPEDIST    = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_DISTANCE)->intValue;
+    static auto* const PSWIPEINVR    = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_INVERT)->intValue;
+    static auto* const PSWIPENEW     = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_CREATE_NEW)->intValue;
+    static auto* const PSWIPEFOREVER = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_FOREVER)->intValue;
+    static auto* const PSWIPENUMBER  = &g_pConfigManager->getConfigValuePtr(CFG_GESTURES_WORKSPACE_SWIPE_NUMBERED)->intValue;
 
     const bool         VERTANIMS = m_sActiveSwipe.pWorkspaceBegin->m_vRenderOffset.getConfig()->pValues->internalStyle == "slidevert";
 
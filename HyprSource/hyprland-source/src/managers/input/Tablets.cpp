@@ -25,6 +25,7 @@ void CInputManager::newTabletTool(wlr_input_device* pDevice) {
             const auto PTAB = (STablet*)owner;
 
             g_pInputManager->m_lTablets.remove(*PTAB);
+            HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
 
             Debug::log(LOG, "Removed a tablet");
         },
@@ -159,6 +160,7 @@ STabletTool* CInputManager::ensureTabletToolPresent(wlr_tablet_tool* pTool) {
 
                 PTOOL->wlrTabletTool->data = nullptr;
                 g_pInputManager->m_lTabletTools.remove(*PTOOL);
+                HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
             },
             PTOOL, "Tablet Tool V1");
 
@@ -230,6 +232,7 @@ void CInputManager::newTabletPad(wlr_input_device* pDevice) {
             const auto PPAD = (STabletPad*)owner;
 
             g_pInputManager->m_lTabletPads.remove(*PPAD);
+            HyprCtl::markStateChanged(SNAPSHOT_DEVICES);
 
             Debug::log(LOG, "Removed a tablet pad");
         },
@@ -74,7 +74,7 @@ APICALL bool HyprlandAPI::removeLayout(HANDLE handle, IHyprLayout* layout) {
 }
 
 APICALL bool HyprlandAPI::reloadConfig() {
-    g_pConfigManager->m_bForceReload = true;
+    g_pConfigManager->scheduleReload();
     return true;
 }
 
@@ -184,6 +184,7 @@ APICALL bool HyprlandAPI::addDispatcher(HANDLE handle, const std::string& name,
     PLUGIN->registeredDispatchers.push_back(name);
 
     g_pKeybindManager->m_mDispatchers[name] = handler;
+    g_pKeybindManager->m_mParsedDispatchers.erase(name); // an overridden builtin has to get strings
 
     return true;
 }
@@ -195,6 +196,7 @@ APICALL bool HyprlandAPI::removeDispatcher(HANDLE handle, const std::string& nam
         return false;
 
     std::erase_if(g_pKeybindManager->m_mDispatchers, [&](const auto& other) { return other.first == name; });
+    g_pKeybindManager->m_mParsedDispatchers.erase(name);
     std::erase_if(PLUGIN->registeredDispatchers, [&](const auto& other) { return other == name; });
 
     return true;
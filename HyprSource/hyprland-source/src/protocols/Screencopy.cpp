@@ -135,6 +135,9 @@ void CScreencopyProtocolManager::removeFrame(SScreencopyFrame* frame, bool force
 
     std::erase_if(m_vFramesAwaitingWrite, [&](const auto& other) { return other == frame; });
 
+    if (frame->readbackPending)
+        g_pHyprOpenGL->m_AsyncReadback.cancel(frame);
+
     wl_resource_set_user_data(frame->resource, nullptr);
     if (frame->buffer && frame->buffer->n_locks > 0)
         wlr_buffer_unlock(frame->buffer);
@@ -185,11 +188,16 @@ void CScreencopyProtocolManager::captureOutput(wl_client* client, wl_resource* r
         return;
     }
 
+#ifndef GLES2
+    // clients are offered the format the output renders in
     if (PFRAME->pMonitor->output->allocator && (PFRAME->pMonitor->output->allocator->buffer_caps & WLR_BUFFER_CAP_DMABUF)) {
         PFRAME->dmabufFormat = PFRAME->pMonitor->output->render_format;
     } else {
         PFRAME->dmabufFormat = DRM_FORMAT_INVALID;
     }
+#else
+    PFRAME->dmabufFormat = DRM_FORMAT_INVALID; // no glBlitFramebuffer
+#endif
 
     if (box.width == 0 && box.height == 0)
         PFRAME->box = {0, 0, (int)(PFRAME->pMonitor->vecSize.x * PFRAME->pMonitor->scale), (int)(PFRAME->pMonitor->vecSize.y * PFRAME->pMonitor->scale)};
@@ -206,10 +214,8 @@ void CScreencopyProtocolManager::captureOutput(wl_client* client, wl_resource* r
     zwlr_screencopy_frame_v1_send_buffer(PFRAME->resource, convert_drm_format_to_wl_shm(PFRAME->shmFormat), PFRAME->box.width, PFRAME->box.height, PFRAME->shmStride);
 
     if (wl_resource_get_version(resource) >= 3) {
-        // todo
-        // if (PFRAME->dmabufFormat != DRM_FORMAT_INVALID) {
-        //     zwlr_screencopy_frame_v1_send_linux_dmabuf(PFRAME->resource, PFRAME->dmabufFormat, PFRAME->box.width, PFRAME->box.height);
-        // }
+        if (PFRAME->dmabufFormat != DRM_FORMAT_INVALID)
+            zwlr_screencopy_frame_v1_send_linux_dmabuf(PFRAME->resource, PFRAME->dmabufFormat, PFRAME->box.width, PFRAME->box.height);
 
         zwlr_screencopy_frame_v1_send_buffer_done(PFRAME->resource);
     }
@@ -302,13 +308,17 @@ void CScreencopyProtocolManager::onRenderEnd(CMonitor* pMonitor) {
 
         shareFrame(f);
 
-        framesToRemove.push_back(f);
+        // still being read back, removed once the pixels land
+        if (!f->readbackPending)
+            framesToRemove.push_back(f);
     }
 
     for (auto& f : framesToRemove) {
         removeFrame(f);
     }
 
+    std::erase_if(m_vFramesAwaitingWrite, [](const auto& f) { return f->readbackPending; });
+
     g_pHyprRenderer->m_bSoftwareCursorsLocked = false;
 
     if (m_vFramesAwaitingWrite.empty()) {
@@ -345,10 +355,17 @@ void CScreencopyProtocolManager::shareFrame(SScreencopyFrame* frame) {
 
     zwlr_screencopy_frame_v1_send_flags(frame->resource, flags);
     sendFrameDamage(frame);
-    uint32_t tvSecHi = (sizeof(now.tv_sec) > 4) ? now.tv_sec >> 32 : 0;
-    uint32_t tvSecLo = now.tv_sec & 0xFFFFFFFF;
-    zwlr_screencopy_frame_v1_send_ready(frame->resource, tvSecHi, tvSecLo, now.tv_nsec);
+
+    if (!frame->readbackPending)
+        sendFrameReady(frame, &now);
 }
+
+void CScreencopyProtocolManager::sendFrameReady(SScreencopyFrame* frame, timespec* now) {
+    uint32_t tvSecHi = (sizeof(now->tv_sec) > 4) ? now->tv_sec >> 32 : 0;
+    uint32_t tvSecLo = now->tv_sec & 0xFFFFFFFF;
+    zwlr_screencopy_frame_v1_send_ready(frame->resource, tvSecHi, tvSecLo, now->tv_nsec);
+}
+
 void CScreencopyProtocolManager::sendFrameDamage(SScreencopyFrame* frame) {
     if (!frame->withDamage)
         return;
@@ -364,6 +381,9 @@ bool CScreencopyProtocolManager::copyFrameShm(SScreencopyFrame* frame, timespec*
     if (!wlr_buffer_begin_data_ptr_access(frame->buffer, WLR_BUFFER_DATA_PTR_ACCESS_WRITE, &data, &format, &stride))
         return false;
 
+    // only the format is needed now, the pixels are written when the readback lands
+    wlr_buffer_end_data_ptr_access(frame->buffer);
+
     // render the client
     const auto        PMONITOR = frame->pMonitor;
     pixman_region32_t fakeDamage;
@@ -372,7 +392,6 @@ bool CScreencopyProtocolManager::copyFrameShm(SScreencopyFrame* frame, timespec*
     if (!wlr_output_attach_render(PMONITOR->output, nullptr)) {
         Debug::log(ERR, "[screencopy] Couldn't attach render");
         pixman_region32_fini(&fakeDamage);
-        wlr_buffer_end_data_ptr_access(frame->buffer);
         return false;
     }
 
@@ -381,7 +400,6 @@ bool CScreencopyProtocolManager::copyFrameShm(SScreencopyFrame* frame, timespec*
         Debug::log(ERR, "[screencopy] Cannot read pixels, unsupported format %x", PFORMAT);
         wlr_output_rollback(PMONITOR->output);
         pixman_region32_fini(&fakeDamage);
-        wlr_buffer_end_data_ptr_access(frame->buffer);
         return false;
     }
 
@@ -390,9 +408,13 @@ bool CScreencopyProtocolManager::copyFrameShm(SScreencopyFrame* frame, timespec*
     // we should still have the last frame by this point in the original fb
     glBindFramebuffer(GL_FRAMEBUFFER, g_pHyprOpenGL->m_RenderData.pCurrentMonData->primaryFB.m_iFb);
 
-    glFinish(); // flush
+    const auto READYTIME = *now;
+    const auto BYTES     = (size_t)stride * frame->box.height;
+
+    g_pHyprOpenGL->m_AsyncReadback.read(frame, frame->box, PFORMAT->gl_format, PFORMAT->gl_type, BYTES,
+                                        [this, frame, READYTIME, BYTES](const uint8_t* pixels) mutable { finishShmCopy(frame, pixels, BYTES, &READYTIME); });
 
-    glReadPixels(frame->box.x, frame->box.y, frame->box.width, frame->box.height, PFORMAT->gl_format, PFORMAT->gl_type, data);
+    frame->readbackPending = true;
 
     glBindFramebuffer(GL_FRAMEBUFFER, g_pHyprOpenGL->m_iWLROutputFb);
 
@@ -402,13 +424,34 @@ bool CScreencopyProtocolManager::copyFrameShm(SScreencopyFrame* frame, timespec*
 
     pixman_region32_fini(&fakeDamage);
 
+    return true;
+}
+
+void CScreencopyProtocolManager::finishShmCopy(SScreencopyFrame* frame, const uint8_t* pixels, size_t bytes, timespec* now) {
+    void*    data;
+    uint32_t format;
+    size_t   stride;
+    if (!pixels || !wlr_buffer_begin_data_ptr_access(frame->buffer, WLR_BUFFER_DATA_PTR_ACCESS_WRITE, &data, &format, &stride)) {
+        zwlr_screencopy_frame_v1_send_failed(frame->resource);
+        removeFrame(frame);
+        return;
+    }
+
+    memcpy(data, pixels, bytes);
     wlr_buffer_end_data_ptr_access(frame->buffer);
 
-    return true;
+    sendFrameReady(frame, now);
+    removeFrame(frame);
 }
 
 bool CScreencopyProtocolManager::copyFrameDmabuf(SScreencopyFrame* frame) {
-    // todo
-    Debug::log(ERR, "DMABUF copying not impl'd!");
-    return false;
+    // the frame that was just committed is still in the monitor's framebuffer
+    const auto PFRAMEBUFFER = &g_pHyprOpenGL->m_mMonitorRenderResources[frame->pMonitor].primaryFB;
+
+    if (!g_pHyprOpenGL->blitFramebufferToBuffer(PFRAMEBUFFER, frame->box, frame->buffer)) {
+        Debug::log(ERR, "[screencopy] Couldn't blit to the dmabuf");
+        return false;
+    }
+
+    return true;
 }
@@ -26,8 +26,9 @@ struct SScreencopyFrame {
     wlr_box            box          = {0};
     int                shmStride    = 0;
 
-    bool               overlayCursor = false;
-    bool               withDamage    = false;
+    bool               overlayCursor   = false;
+    bool               withDamage      = false;
+    bool               readbackPending = false; // shm copy queued on the GPU, ready is sent when it lands
 
     wlr_buffer_cap     bufferCap = WLR_BUFFER_CAP_SHM;
 
@@ -66,6 +67,8 @@ class CScreencopyProtocolManager {
 
     void                           shareFrame(SScreencopyFrame* frame);
     void                           sendFrameDamage(SScreencopyFrame* frame);
+    void                           sendFrameReady(SScreencopyFrame* frame, timespec* now);
+    void                           finishShmCopy(SScreencopyFrame* frame, const uint8_t* pixels, size_t bytes, timespec* now);
     bool                           copyFrameDmabuf(SScreencopyFrame* frame);
     bool                           copyFrameShm(SScreencopyFrame* frame, timespec* now);
 };
\ No newline at end of file
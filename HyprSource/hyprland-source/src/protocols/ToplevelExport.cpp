@@ -134,6 +134,9 @@ void CToplevelExportProtocolManager::removeFrame(SToplevelFrame* frame, bool for
 
     std::erase_if(m_vFramesAwaitingWrite, [&](const auto& other) { return other == frame; });
 
+    if (frame->readbackPending)
+        g_pHyprOpenGL->m_AsyncReadback.cancel(frame);
+
     wl_resource_set_user_data(frame->resource, nullptr);
     wlr_buffer_unlock(frame->buffer);
     removeClient(frame->client, force);
@@ -193,11 +196,16 @@ void CToplevelExportProtocolManager::captureToplevel(wl_client* client, wl_resou
         return;
     }
 
+#ifndef GLES2
+    // clients are offered the format the output renders in
     if (PMONITOR->output->allocator && (PMONITOR->output->allocator->buffer_caps & WLR_BUFFER_CAP_DMABUF)) {
         PFRAME->dmabufFormat = PMONITOR->output->render_format;
     } else {
         PFRAME->dmabufFormat = DRM_FORMAT_INVALID;
     }
+#else
+    PFRAME->dmabufFormat = DRM_FORMAT_INVALID; // no glBlitFramebuffer
+#endif
 
     PFRAME->box = {0, 0, (int)(PFRAME->pWindow->m_vRealSize.vec().x * PMONITOR->scale), (int)(PFRAME->pWindow->m_vRealSize.vec().y * PMONITOR->scale)};
     int ow, oh;
@@ -207,6 +215,11 @@ void CToplevelExportProtocolManager::captureToplevel(wl_client* client, wl_resou
     PFRAME->shmStride = (PSHMINFO->bpp / 8) * PFRAME->box.width;
 
     hyprland_toplevel_export_frame_v1_send_buffer(PFRAME->resource, convert_drm_format_to_wl_shm(PFRAME->shmFormat), PFRAME->box.width, PFRAME->box.height, PFRAME->shmStride);
+
+    if (PFRAME->dmabufFormat != DRM_FORMAT_INVALID)
+        hyprland_toplevel_export_frame_v1_send_linux_dmabuf(PFRAME->resource, PFRAME->dmabufFormat, PFRAME->box.width, PFRAME->box.height);
+
+    hyprland_toplevel_export_frame_v1_send_buffer_done(PFRAME->resource);
 }
 
 void CToplevelExportProtocolManager::copyFrame(wl_client* client, wl_resource* resource, wl_resource* buffer, int32_t ignore_damage) {
@@ -299,12 +312,16 @@ void CToplevelExportProtocolManager::onMonitorRender(CMonitor* pMonitor) {
 
         shareFrame(f);
 
-        framesToRemove.push_back(f);
+        // still being read back, removed once the pixels land
+        if (!f->readbackPending)
+            framesToRemove.push_back(f);
     }
 
     for (auto& f : framesToRemove) {
         removeFrame(f);
     }
+
+    std::erase_if(m_vFramesAwaitingWrite, [](const auto& f) { return f->readbackPending; });
 }
 
 void CToplevelExportProtocolManager::shareFrame(SToplevelFrame* frame) {
@@ -319,7 +336,7 @@ void CToplevelExportProtocolManager::shareFrame(SToplevelFrame* frame) {
 
     uint32_t flags = 0;
     if (frame->bufferCap == WLR_BUFFER_CAP_DMABUF) {
-        if (!copyFrameDmabuf(frame)) {
+        if (!copyFrameDmabuf(frame, &now)) {
             hyprland_toplevel_export_frame_v1_send_failed(frame->resource);
             return;
         }
@@ -332,9 +349,15 @@ void CToplevelExportProtocolManager::shareFrame(SToplevelFrame* frame) {
 
     hyprland_toplevel_export_frame_v1_send_flags(frame->resource, flags);
     // todo: send damage
-    uint32_t tvSecHi = (sizeof(now.tv_sec) > 4) ? now.tv_sec >> 32 : 0;
-    uint32_t tvSecLo = now.tv_sec & 0xFFFFFFFF;
-    hyprland_toplevel_export_frame_v1_send_ready(frame->resource, tvSecHi, tvSecLo, now.tv_nsec);
+
+    if (!frame->readbackPending)
+        sendFrameReady(frame, &now);
+}
+
+void CToplevelExportProtocolManager::sendFrameReady(SToplevelFrame* frame, timespec* now) {
+    uint32_t tvSecHi = (sizeof(now->tv_sec) > 4) ? now->tv_sec >> 32 : 0;
+    uint32_t tvSecLo = now->tv_sec & 0xFFFFFFFF;
+    hyprland_toplevel_export_frame_v1_send_ready(frame->resource, tvSecHi, tvSecLo, now->tv_nsec);
 }
 
 bool CToplevelExportProtocolManager::copyFrameShm(SToplevelFrame* frame, timespec* now) {
@@ -344,24 +367,91 @@ bool CToplevelExportProtocolManager::copyFrameShm(SToplevelFrame* frame, timespe
     if (!wlr_buffer_begin_data_ptr_access(frame->buffer, WLR_BUFFER_DATA_PTR_ACCESS_WRITE, &data, &format, &stride))
         return false;
 
-    // render the client
-    const auto        PMONITOR = g_pCompositor->getMonitorFromID(frame->pWindow->m_iMonitorID);
+    // only the format is needed now, the pixels are written when the readback lands
+    wlr_buffer_end_data_ptr_access(frame->buffer);
+
+    const auto PFORMAT = get_gles2_format_from_drm(format);
+    if (!PFORMAT) {
+        Debug::log(ERR, "[toplevel_export] Cannot read pixels, unsupported format %x", PFORMAT);
+        return false;
+    }
+
     pixman_region32_t fakeDamage;
-    pixman_region32_init_rect(&fakeDamage, 0, 0, PMONITOR->vecPixelSize.x * 10, PMONITOR->vecPixelSize.y * 10);
+    const auto        PMONITOR = renderFrameWindow(frame, &fakeDamage, now);
+
+    if (!PMONITOR)
+        return false;
+
+    // copy pixels
+    glBindFramebuffer(GL_FRAMEBUFFER, g_pHyprOpenGL->m_RenderData.pCurrentMonData->primaryFB.m_iFb);
+
+    const auto READYTIME = *now;
+    const auto BYTES     = (size_t)stride * frame->box.height;
+
+    g_pHyprOpenGL->m_AsyncReadback.read(frame, {0, 0, frame->box.width, frame->box.height}, PFORMAT->gl_format, PFORMAT->gl_type, BYTES,
+                                        [this, frame, READYTIME, BYTES](const uint8_t* pixels) mutable { finishShmCopy(frame, pixels, BYTES, &READYTIME); });
+
+    frame->readbackPending = true;
+
+    finishFrameRender(frame, PMONITOR, &fakeDamage);
+
+    return true;
+}
+
+void CToplevelExportProtocolManager::finishShmCopy(SToplevelFrame* frame, const uint8_t* pixels, size_t bytes, timespec* now) {
+    void*    data;
+    uint32_t format;
+    size_t   stride;
+    if (!pixels || !wlr_buffer_begin_data_ptr_access(frame->buffer, WLR_BUFFER_DATA_PTR_ACCESS_WRITE, &data, &format, &stride)) {
+        hyprland_toplevel_export_frame_v1_send_failed(frame->resource);
+        removeFrame(frame);
+        return;
+    }
+
+    memcpy(data, pixels, bytes);
+    wlr_buffer_end_data_ptr_access(frame->buffer);
+
+    sendFrameReady(frame, now);
+    removeFrame(frame);
+}
+
+bool CToplevelExportProtocolManager::copyFrameDmabuf(SToplevelFrame* frame, timespec* now) {
+    pixman_region32_t fakeDamage;
+    const auto        PMONITOR = renderFrameWindow(frame, &fakeDamage, now);
+
+    if (!PMONITOR)
+        return false;
+
+    const auto PFRAMEBUFFER = &g_pHyprOpenGL->m_RenderData.pCurrentMonData->primaryFB;
+
+    // the blit binds the client's buffer, so it goes after the output's is rolled back
+    finishFrameRender(frame, PMONITOR, &fakeDamage);
+
+    if (!g_pHyprOpenGL->blitFramebufferToBuffer(PFRAMEBUFFER, {0, 0, frame->box.width, frame->box.height}, frame->buffer)) {
+        Debug::log(ERR, "[toplevel_export] Couldn't blit to the dmabuf");
+        return false;
+    }
+
+    return true;
+}
+
+CMonitor* CToplevelExportProtocolManager::renderFrameWindow(SToplevelFrame* frame, pixman_region32_t* damage, timespec* now) {
+    const auto PMONITOR = g_pCompositor->getMonitorFromID(frame->pWindow->m_iMonitorID);
+    pixman_region32_init_rect(damage, 0, 0, PMONITOR->vecPixelSize.x * 10, PMONITOR->vecPixelSize.y * 10);
 
     if (frame->overlayCursor)
         wlr_output_lock_software_cursors(PMONITOR->output, true);
 
     if (!wlr_output_attach_render(PMONITOR->output, nullptr)) {
         Debug::log(ERR, "[toplevel_export] Couldn't attach render");
-        pixman_region32_fini(&fakeDamage);
-        wlr_buffer_end_data_ptr_access(frame->buffer);
+        pixman_region32_fini(damage);
         if (frame->overlayCursor)
             wlr_output_lock_software_cursors(PMONITOR->output, false);
-        return false;
+        return nullptr;
     }
 
-    g_pHyprOpenGL->begin(PMONITOR, &fakeDamage, true);
+    g_pHyprOpenGL->begin(PMONITOR, damage, true);
+
     g_pHyprOpenGL->clear(CColor(0, 0, 0, 1.0));
 
     // render client at 0,0
@@ -391,42 +481,18 @@ bool CToplevelExportProtocolManager::copyFrameShm(SToplevelFrame* frame, timespe
         wlr_renderer_end(g_pCompositor->m_sWLRRenderer);
     }
 
-    // copy pixels
-    const auto PFORMAT = get_gles2_format_from_drm(format);
-    if (!PFORMAT) {
-        Debug::log(ERR, "[toplevel_export] Cannot read pixels, unsupported format %x", PFORMAT);
-        g_pHyprOpenGL->end();
-        pixman_region32_fini(&fakeDamage);
-        wlr_buffer_end_data_ptr_access(frame->buffer);
-        if (frame->overlayCursor)
-            wlr_output_lock_software_cursors(PMONITOR->output, false);
-        return false;
-    }
-
-    glBindFramebuffer(GL_FRAMEBUFFER, g_pHyprOpenGL->m_RenderData.pCurrentMonData->primaryFB.m_iFb);
-
-    glFinish(); // flush
-
-    glReadPixels(0, 0, frame->box.width, frame->box.height, PFORMAT->gl_format, PFORMAT->gl_type, data);
+    return PMONITOR;
+}
 
+void CToplevelExportProtocolManager::finishFrameRender(SToplevelFrame* frame, CMonitor* pMonitor, pixman_region32_t* damage) {
     g_pHyprOpenGL->end();
 
-    wlr_output_rollback(PMONITOR->output);
+    wlr_output_rollback(pMonitor->output);
 
-    pixman_region32_fini(&fakeDamage);
-
-    wlr_buffer_end_data_ptr_access(frame->buffer);
+    pixman_region32_fini(damage);
 
     if (frame->overlayCursor)
-        wlr_output_lock_software_cursors(PMONITOR->output, false);
-
-    return true;
-}
-
-bool CToplevelExportProtocolManager::copyFrameDmabuf(SToplevelFrame* frame) {
-    // todo
-    Debug::log(ERR, "DMABUF copying not impl'd!");
-    return false;
+        wlr_output_lock_software_cursors(pMonitor->output, false);
 }
 
 void CToplevelExportProtocolManager::onWindowUnmap(CWindow* pWindow) {
@@ -28,7 +28,8 @@ struct SToplevelFrame {
     wlr_box          box          = {0};
     int              shmStride    = 0;
 
-    bool             overlayCursor = false;
+    bool             overlayCursor   = false;
+    bool             readbackPending = false; // shm copy queued on the GPU, ready is sent when it lands
 
     wlr_buffer_cap   bufferCap = WLR_BUFFER_CAP_SHM;
 
@@ -63,8 +64,13 @@ class CToplevelExportProtocolManager {
     std::vector<SToplevelFrame*> m_vFramesAwaitingWrite;
 
     void                         shareFrame(SToplevelFrame* frame);
-    bool                         copyFrameDmabuf(SToplevelFrame* frame);
+    bool                         copyFrameDmabuf(SToplevelFrame* frame, timespec* now);
     bool                         copyFrameShm(SToplevelFrame* frame, timespec* now);
+    void                         sendFrameReady(SToplevelFrame* frame, timespec* now);
+    void                         finishShmCopy(SToplevelFrame* frame, const uint8_t* pixels, size_t bytes, timespec* now);
+    // renders the window at 0,0 into its monitor's framebuffer and leaves it bound, nullptr on failure. copy out, then finishFrameRender.
+    CMonitor*                    renderFrameWindow(SToplevelFrame* frame, pixman_region32_t* damage, timespec* now);
+    void                         finishFrameRender(SToplevelFrame* frame, CMonitor* pMonitor, pixman_region32_t* damage);
 
     void                         onMonitorRender(CMonitor* pMonitor);
 };
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "AsyncReadback.hpp"
+#include "../Compositor.hpp"
+
+#include <algorithm>
+
+static int onPollTimer(void* data) {
+    ((CAsyncReadback*)data)->poll();
+    return 0;
+}
+
+void CAsyncReadback::read(void* owner, const wlr_box& box, GLenum format, GLenum type, size_t bytes, std::function<void(const uint8_t*)> onDone) {
+    auto IT = std::find_if(m_vReadbacks.begin(), m_vReadbacks.end(), [](const auto& r) { return !r.busy; });
+    if (IT == m_vReadbacks.end())
+        IT = m_vReadbacks.emplace(m_vReadbacks.end());
+
+    auto& readback  = *IT;
+    readback.busy   = true;
+    readback.owner  = owner;
+    readback.onDone = onDone;
+
+#ifndef GLES2
+    if (!readback.pbo)
+        glGenBuffers(1, &readback.pbo);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+
+    if (readback.size != bytes) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+        readback.size = bytes;
+    }
+
+    // with a pack buffer bound the last argument is an offset into it, this only queues the copy
+    glReadPixels(box.x, box.y, box.width, box.height, format, type, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush(); // so the fence is submitted and can signal without us waiting on it
+#else
+    readback.size = bytes;
+    readback.pixels.resize(bytes);
+    glReadPixels(box.x, box.y, box.width, box.height, format, type, readback.pixels.data());
+#endif
+
+    if (!m_pTimer)
+        m_pTimer = wl_event_loop_add_timer(g_pCompositor->m_sWLEventLoop, onPollTimer, this);
+
+    wl_event_source_timer_update(m_pTimer, ASYNC_READBACK_POLL_MS);
+}
+
+void CAsyncReadback::cancel(void* owner) {
+    for (auto& r : m_vReadbacks) {
+        if (r.busy && r.owner == owner) {
+            // the GPU may still be writing into the buffer, it's released when the fence signals
+            r.owner  = nullptr;
+            r.onDone = nullptr;
+        }
+    }
+}
+
+void CAsyncReadback::finish(SReadback& readback, bool ok) {
+    // taken out first, onDone usually ends up cancelling its owner
+    const auto ONDONE = std::move(readback.onDone);
+    readback.onDone   = nullptr;
+    readback.owner    = nullptr;
+
+#ifndef GLES2
+    glDeleteSync(readback.fence);
+    readback.fence = nullptr;
+
+    const uint8_t* pixels = nullptr;
+    if (ok && ONDONE) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+        pixels = (const uint8_t*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback.size, GL_MAP_READ_BIT);
+    }
+
+    if (ONDONE)
+        ONDONE(pixels);
+
+    if (pixels)
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#else
+    if (ONDONE)
+        ONDONE(ok ? readback.pixels.data() : nullptr);
+#endif
+
+    readback.busy = false;
+}
+
+void CAsyncReadback::poll() {
+    if (eglGetCurrentContext() != wlr_egl_get_context(g_pCompositor->m_sWLREGL))
+        eglMakeCurrent(wlr_egl_get_display(g_pCompositor->m_sWLREGL), EGL_NO_SURFACE, EGL_NO_SURFACE, wlr_egl_get_context(g_pCompositor->m_sWLREGL));
+
+    bool pending = false;
+
+    for (auto& r : m_vReadbacks) {
+        if (!r.busy)
+            continue;
+
+#ifndef GLES2
+        const auto STATUS = glClientWaitSync(r.fence, 0, 0);
+
+        if (STATUS == GL_TIMEOUT_EXPIRED) {
+            pending = true;
+            continue;
+        }
+
+        if (STATUS == GL_WAIT_FAILED)
+            Debug::log(ERR, "AsyncReadback: waiting on a readback fence failed");
+
+        finish(r, STATUS != GL_WAIT_FAILED);
+#else
+        finish(r, true);
+#endif
+    }
+
+    if (pending)
+        wl_event_source_timer_update(m_pTimer, ASYNC_READBACK_POLL_MS);
+}
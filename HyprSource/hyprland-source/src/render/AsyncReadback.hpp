@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../defines.hpp"
+#include <functional>
+#include <vector>
+
+// glReadPixels into pixel buffer objects with a fence after them, finished by a timer on a later loop iteration
+// instead of stalling the frame on glFinish. one capture per frame keeps two buffers cycling, more are added while all are in flight.
+// the legacy GLES2 renderer has neither, there the read is synchronous and only the callback is deferred.
+#define ASYNC_READBACK_POLL_MS 1
+
+class CAsyncReadback {
+  public:
+    // reads box out of the bound read framebuffer. onDone gets the rows as glReadPixels lays them out, or nullptr if the read failed.
+    // it's never called from inside read() and mustn't queue another read, owner is only there for cancel()
+    void read(void* owner, const wlr_box& box, GLenum format, GLenum type, size_t bytes, std::function<void(const uint8_t*)> onDone);
+    void cancel(void* owner); // onDone won't be called
+
+    void poll();
+
+  private:
+    struct SReadback {
+        bool                                busy  = false;
+        void*                               owner = nullptr;
+        std::function<void(const uint8_t*)> onDone;
+        size_t                              size = 0;
+#ifndef GLES2
+        GLuint pbo   = 0;
+        GLsync fence = nullptr;
+#else
+        std::vector<uint8_t> pixels;
+#endif
+    };
+
+    void                   finish(SReadback&, bool ok);
+
+    std::vector<SReadback> m_vReadbacks;
+    wl_event_source*       m_pTimer = nullptr; // owned by the event loop, buffers go with the EGL context
+};
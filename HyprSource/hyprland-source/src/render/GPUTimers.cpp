@@ -0,0 +1,201 @@
+#include "GPUTimers.hpp"
+#include "../Compositor.hpp"
+
+CGPUTimers::~CGPUTimers() {
+    for (auto& [m, timers] : m_mMonitors) {
+        for (auto& frame : timers.frames) {
+            if (!frame.queries.empty())
+                m_pDeleteQueries(frame.queries.size(), frame.queries.data());
+        }
+    }
+}
+
+bool CGPUTimers::init(const std::string& extensions) {
+    if (!extensions.contains("GL_EXT_disjoint_timer_query")) {
+        Debug::log(LOG, "GPU timers: GL_EXT_disjoint_timer_query not supported, per pass GPU times won't be available");
+        return false;
+    }
+
+    m_pGenQueries         = (PFNGLGENQUERIESEXTPROC)eglGetProcAddress("glGenQueriesEXT");
+    m_pDeleteQueries      = (PFNGLDELETEQUERIESEXTPROC)eglGetProcAddress("glDeleteQueriesEXT");
+    m_pQueryCounter       = (PFNGLQUERYCOUNTEREXTPROC)eglGetProcAddress("glQueryCounterEXT");
+    m_pGetQueryiv         = (PFNGLGETQUERYIVEXTPROC)eglGetProcAddress("glGetQueryivEXT");
+    m_pGetQueryObjectuiv  = (PFNGLGETQUERYOBJECTUIVEXTPROC)eglGetProcAddress("glGetQueryObjectuivEXT");
+    m_pGetQueryObjectui64 = (PFNGLGETQUERYOBJECTUI64VEXTPROC)eglGetProcAddress("glGetQueryObjectui64vEXT");
+
+    if (!m_pGenQueries || !m_pDeleteQueries || !m_pQueryCounter || !m_pGetQueryiv || !m_pGetQueryObjectuiv || !m_pGetQueryObjectui64) {
+        Debug::log(WARN, "GPU timers: GL_EXT_disjoint_timer_query is advertised but its functions couldn't be loaded");
+        return false;
+    }
+
+    // the extension allows drivers without timestamp support, they report 0 bits
+    GLint bits = 0;
+    m_pGetQueryiv(GL_TIMESTAMP_EXT, GL_QUERY_COUNTER_BITS_EXT, &bits);
+
+    if (bits == 0) {
+        Debug::log(LOG, "GPU timers: driver has no timestamp queries, per pass GPU times won't be available");
+        return false;
+    }
+
+    m_bSupported = true;
+
+    return true;
+}
+
+bool CGPUTimers::supported() {
+    return m_bSupported;
+}
+
+size_t CGPUTimers::stamp(SFrame& frame) {
+    if (frame.used == frame.queries.size()) {
+        GLuint query = 0;
+        m_pGenQueries(1, &query);
+        frame.queries.push_back(query);
+    }
+
+    m_pQueryCounter(frame.queries[frame.used], GL_TIMESTAMP_EXT);
+
+    return frame.used++;
+}
+
+void CGPUTimers::checkDisjoint() {
+    // reading GL_GPU_DISJOINT_EXT also clears it, so whoever reads it has to tell every frame still in flight
+    GLint disjoint = 0;
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+
+    if (!disjoint)
+        return;
+
+    for (auto& [m, timers] : m_mMonitors) {
+        for (auto& frame : timers.frames) {
+            if (frame.pending)
+                frame.disjoint = true;
+        }
+    }
+}
+
+void CGPUTimers::resolve(CMonitor* pMonitor, SFrame& frame) {
+    auto& times = m_mTimes[pMonitor];
+
+    // queries finish in order, if the last one is there all of them are
+    GLuint available = 0;
+    m_pGetQueryObjectuiv(frame.queries[frame.used - 1], GL_QUERY_RESULT_AVAILABLE_EXT, &available);
+
+    if (!available || frame.disjoint) {
+        times.dropped++;
+        return;
+    }
+
+    std::array<float, GPU_PASS_COUNT> ms = {};
+
+    for (auto& range : frame.ranges) {
+        if (range.end == 0)
+            continue; // never closed
+
+        GLuint64 begin = 0, end = 0;
+        m_pGetQueryObjectui64(frame.queries[range.begin], GL_QUERY_RESULT_EXT, &begin);
+        m_pGetQueryObjectui64(frame.queries[range.end], GL_QUERY_RESULT_EXT, &end);
+
+        if (end > begin)
+            ms[range.pass] += (end - begin) / 1000000.f;
+    }
+
+    for (size_t i = 0; i < GPU_PASS_COUNT; ++i)
+        times.smoothed[i] = times.frames == 0 ? ms[i] : times.smoothed[i] * 0.9f + ms[i] * 0.1f;
+
+    times.last = ms;
+    times.frames++;
+}
+
+void CGPUTimers::beginFrame(CMonitor* pMonitor) {
+    static auto* const PGPUTIMERS = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_GPU_TIMERS)->intValue;
+
+    auto&              timers = m_mMonitors[pMonitor];
+    timers.active             = m_bSupported && *PGPUTIMERS;
+
+    if (!timers.active)
+        return;
+
+    checkDisjoint();
+
+    timers.current = (timers.current + 1) % GPU_TIMER_FRAMES;
+    auto& frame    = timers.frames[timers.current];
+
+    // issued GPU_TIMER_FRAMES frames ago, normally long done
+    if (frame.pending)
+        resolve(pMonitor, frame);
+
+    frame.used     = 0;
+    frame.pending  = false;
+    frame.disjoint = false;
+    frame.ranges.clear();
+    frame.open.clear();
+}
+
+void CGPUTimers::endFrame(CMonitor* pMonitor) {
+    auto& timers = m_mMonitors[pMonitor];
+
+    if (!timers.active)
+        return;
+
+    auto& frame   = timers.frames[timers.current];
+    frame.pending = frame.used > 0;
+    timers.active = false;
+}
+
+void CGPUTimers::beginPass(CMonitor* pMonitor, eGPUPass pass) {
+    if (!pMonitor)
+        return;
+
+    auto& timers = m_mMonitors[pMonitor];
+
+    if (!timers.active)
+        return;
+
+    auto& frame = timers.frames[timers.current];
+    frame.open.push_back(frame.ranges.size());
+    frame.ranges.push_back({pass, stamp(frame), 0});
+}
+
+void CGPUTimers::endPass(CMonitor* pMonitor, eGPUPass pass) {
+    if (!pMonitor)
+        return;
+
+    auto& timers = m_mMonitors[pMonitor];
+
+    if (!timers.active)
+        return;
+
+    auto& frame = timers.frames[timers.current];
+
+    if (frame.open.empty() || frame.ranges[frame.open.back()].pass != pass) {
+        Debug::log(ERR, "GPU timers: unbalanced pass %s", GPU_PASS_NAMES[pass]);
+        return;
+    }
+
+    frame.ranges[frame.open.back()].end = stamp(frame);
+    frame.open.pop_back();
+}
+
+void CGPUTimers::destroyMonitor(CMonitor* pMonitor) {
+    const auto IT = m_mMonitors.find(pMonitor);
+
+    if (IT != m_mMonitors.end()) {
+        for (auto& frame : IT->second.frames) {
+            if (!frame.queries.empty())
+                m_pDeleteQueries(frame.queries.size(), frame.queries.data());
+        }
+
+        m_mMonitors.erase(IT);
+    }
+
+    m_mTimes.erase(pMonitor);
+}
+
+CGPUPassScope::CGPUPassScope(eGPUPass pass) : m_pMonitor(g_pHyprOpenGL->m_RenderData.pMonitor), m_ePass(pass) {
+    g_pHyprOpenGL->m_GPUTimers.beginPass(m_pMonitor, m_ePass);
+}
+
+CGPUPassScope::~CGPUPassScope() {
+    g_pHyprOpenGL->m_GPUTimers.endPass(m_pMonitor, m_ePass);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../defines.hpp"
+#include <array>
+#include <unordered_map>
+#include <GLES2/gl2ext.h>
+
+class CMonitor;
+
+enum eGPUPass {
+    GPU_PASS_PREBLUR = 0,
+    GPU_PASS_BLUR,
+    GPU_PASS_LAYERS,
+    GPU_PASS_WINDOWS,
+    GPU_PASS_DECORATIONS,
+    GPU_PASS_OVERLAYS,
+    GPU_PASS_BLIT,
+    GPU_PASS_COUNT
+};
+
+inline const char* GPU_PASS_NAMES[GPU_PASS_COUNT] = {"preblur", "blur", "layers", "windows", "decorations", "overlays", "blit"};
+
+// ms of GPU time per pass. passes are inclusive, windows contain their own decorations and blur.
+struct SGPUPassTimes {
+    std::array<float, GPU_PASS_COUNT> last     = {};
+    std::array<float, GPU_PASS_COUNT> smoothed = {}; // exponential moving average
+    uint64_t                          frames   = 0;
+    uint64_t                          dropped  = 0; // results that weren't ready in time or were disjoint
+};
+
+// timestamp queries around render passes (GL_EXT_disjoint_timer_query).
+// every monitor cycles through GPU_TIMER_FRAMES sets of queries and only reads a set back when it comes around again,
+// if the results still aren't available by then the frame is dropped, the render loop never waits on the GPU.
+#define GPU_TIMER_FRAMES 2
+
+#define GPU_PASS_CONCAT_IMPL(a, b) a##b
+#define GPU_PASS_CONCAT(a, b)      GPU_PASS_CONCAT_IMPL(a, b)
+#define GPU_PASS_SCOPE(pass)       CGPUPassScope GPU_PASS_CONCAT(gpuPassScope, __LINE__)(pass)
+
+class CGPUTimers {
+  public:
+    ~CGPUTimers();
+
+    // loads the extension, false if the driver can't do timestamp queries
+    bool                                           init(const std::string& extensions);
+    bool                                           supported();
+
+    void                                           beginFrame(CMonitor*);
+    void                                           endFrame(CMonitor*);
+    void                                           beginPass(CMonitor*, eGPUPass);
+    void                                           endPass(CMonitor*, eGPUPass);
+
+    void                                           destroyMonitor(CMonitor*);
+
+    std::unordered_map<CMonitor*, SGPUPassTimes>   m_mTimes;
+
+  private:
+    struct SRange {
+        eGPUPass pass  = GPU_PASS_COUNT;
+        size_t   begin = 0;
+        size_t   end   = 0;
+    };
+
+    struct SFrame {
+        std::vector<GLuint> queries; // pool, only grows
+        size_t              used = 0;
+        std::vector<SRange> ranges;
+        std::vector<size_t> open; // indices into ranges, passes nest
+        bool                pending  = false;
+        bool                disjoint = false; // the GPU saw a disjoint event while this frame was in flight
+    };
+
+    struct SMonitorTimers {
+        std::array<SFrame, GPU_TIMER_FRAMES> frames;
+        size_t                               current = 0;
+        bool                                 active  = false;
+    };
+
+    size_t                                         stamp(SFrame&);
+    void                                           checkDisjoint();
+    void                                           resolve(CMonitor*, SFrame&);
+
+    std::unordered_map<CMonitor*, SMonitorTimers>  m_mMonitors;
+    bool                                           m_bSupported = false;
+
+    PFNGLGENQUERIESEXTPROC                         m_pGenQueries         = nullptr;
+    PFNGLDELETEQUERIESEXTPROC                      m_pDeleteQueries      = nullptr;
+    PFNGLQUERYCOUNTEREXTPROC                       m_pQueryCounter       = nullptr;
+    PFNGLGETQUERYIVEXTPROC                         m_pGetQueryiv         = nullptr;
+    PFNGLGETQUERYOBJECTUIVEXTPROC                  m_pGetQueryObjectuiv  = nullptr;
+    PFNGLGETQUERYOBJECTUI64VEXTPROC                m_pGetQueryObjectui64 = nullptr;
+};
+
+// times the enclosing scope on the monitor currently being rendered
+class CGPUPassScope {
+  public:
+    CGPUPassScope(eGPUPass pass);
+    ~CGPUPassScope();
+
+    CGPUPassScope(const CGPUPassScope&)            = delete;
+    CGPUPassScope& operator=(const CGPUPassScope&) = delete;
+
+  private:
+    CMonitor* m_pMonitor = nullptr;
+    eGPUPass  m_ePass    = GPU_PASS_COUNT;
+};
@@ -26,6 +26,8 @@ CHyprOpenGLImpl::CHyprOpenGLImpl() {
     Debug::log(WARN, "!RENDERER: Using the legacy GLES2 renderer!");
 #endif
 
+    m_GPUTimers.init(m_szExtensions);
+
     g_pHookSystem->hookDynamic("preRender", [&](void* self, std::any data) { preRender(std::any_cast<CMonitor*>(data)); });
 
     pixman_region32_init(&m_rOriginalDamageRegion);
@@ -140,8 +142,11 @@ void CHyprOpenGLImpl::begin(CMonitor* pMonitor, pixman_region32_t* pDamage, bool
 
     if (m_bReloadScreenShader) {
         m_bReloadScreenShader = false;
-        applyScreenShader(g_pConfigManager->getString("decoration:screen_shader"));
+        applyScreenShader(g_pConfigManager->getString(CFG_DECORATION_SCREEN_SHADER));
     }
+
+    if (!fake)
+        m_GPUTimers.beginFrame(pMonitor);
 }
 
 void CHyprOpenGLImpl::end() {
@@ -160,10 +165,14 @@ void CHyprOpenGLImpl::end() {
         m_bEndFrame         = true;
         m_bApplyFinalShader = true;
 
+        m_GPUTimers.beginPass(m_RenderData.pMonitor, GPU_PASS_BLIT);
         renderTexture(m_RenderData.pCurrentMonData->primaryFB.m_cTex, &monbox, 1.f, 0);
+        m_GPUTimers.endPass(m_RenderData.pMonitor, GPU_PASS_BLIT);
 
         m_bApplyFinalShader = false;
         m_bEndFrame         = false;
+
+        m_GPUTimers.endFrame(m_RenderData.pMonitor);
     }
 
     // reset our data
@@ -328,7 +337,7 @@ void CHyprOpenGLImpl::applyScreenShader(const std::string& path) {
     m_sFinalScreenShader.proj = glGetUniformLocation(m_sFinalScreenShader.program, "proj");
     m_sFinalScreenShader.tex  = glGetUniformLocation(m_sFinalScreenShader.program, "tex");
     m_sFinalScreenShader.time = glGetUniformLocation(m_sFinalScreenShader.program, "time");
-    if (m_sFinalScreenShader.time != -1 && g_pConfigManager->getInt("debug:damage_tracking") != 0 && !g_pHyprRenderer->m_bCrashingInProgress) {
+    if (m_sFinalScreenShader.time != -1 && g_pConfigManager->getInt(CFG_DEBUG_DAMAGE_TRACKING) != 0 && !g_pHyprRenderer->m_bCrashingInProgress) {
         // The screen shader uses the "time" uniform
         // Since the screen shader could change every frame, damage tracking *needs* to be disabled
         g_pConfigManager->addParseError("Screen shader: Screen shader uses uniform 'time', which requires debug:damage_tracking to be switched off.\n"
@@ -431,7 +440,7 @@ void CHyprOpenGLImpl::renderRectWithDamage(wlr_box* box, const CColor& col, pixm
     const auto         TOPLEFT  = Vector2D(transformedBox.x, transformedBox.y);
     const auto         FULLSIZE = Vector2D(transformedBox.width, transformedBox.height);
 
-    static auto* const PMULTISAMPLEEDGES = &g_pConfigManager->getConfigValuePtr("decoration:multisample_edges")->intValue;
+    static auto* const PMULTISAMPLEEDGES = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_MULTISAMPLE_EDGES)->intValue;
 
     // Rounded corners
     glUniform2f(m_RenderData.pCurrentMonData->m_shQUAD.topLeft, (float)TOPLEFT.x, (float)TOPLEFT.y);
@@ -497,7 +506,7 @@ void CHyprOpenGLImpl::renderTextureInternalWithDamage(const CTexture& tex, wlr_b
     if (!pixman_region32_not_empty(m_RenderData.pDamage))
         return;
 
-    static auto* const PDIMINACTIVE = &g_pConfigManager->getConfigValuePtr("decoration:dim_inactive")->intValue;
+    static auto* const PDIMINACTIVE = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DIM_INACTIVE)->intValue;
 
     // get transform
     const auto TRANSFORM = wlr_output_transform_invert(!m_bEndFrame ? WL_OUTPUT_TRANSFORM_NORMAL : m_RenderData.pMonitor->transform);
@@ -554,7 +563,7 @@ void CHyprOpenGLImpl::renderTextureInternalWithDamage(const CTexture& tex, wlr_b
 #endif
     glUniform1i(shader->tex, 0);
 
-    if ((usingFinalShader && g_pConfigManager->getInt("debug:damage_tracking") == 0) || CRASHING) {
+    if ((usingFinalShader && g_pConfigManager->getInt(CFG_DEBUG_DAMAGE_TRACKING) == 0) || CRASHING) {
         glUniform1f(shader->time, m_tGlobalTimer.getSeconds());
     } else if (usingFinalShader && shader->time > 0) {
         // Don't let time be unitialised
@@ -584,7 +593,7 @@ void CHyprOpenGLImpl::renderTextureInternalWithDamage(const CTexture& tex, wlr_b
 
     const auto         TOPLEFT           = Vector2D(transformedBox.x, transformedBox.y);
     const auto         FULLSIZE          = Vector2D(transformedBox.width, transformedBox.height);
-    static auto* const PMULTISAMPLEEDGES = &g_pConfigManager->getConfigValuePtr("decoration:multisample_edges")->intValue;
+    static auto* const PMULTISAMPLEEDGES = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_MULTISAMPLE_EDGES)->intValue;
 
     if (!usingFinalShader) {
         // Rounded corners
@@ -653,6 +662,8 @@ void CHyprOpenGLImpl::renderTextureInternalWithDamage(const CTexture& tex, wlr_b
 //
 // Dual (or more) kawase blur
 CFramebuffer* CHyprOpenGLImpl::blurMainFramebufferWithDamage(float a, wlr_box* pBox, pixman_region32_t* originalDamage) {
+    TRACE_SCOPE("render", "blur");
+    GPU_PASS_SCOPE(GPU_PASS_BLUR);
 
     glDisable(GL_BLEND);
     glDisable(GL_STENCIL_TEST);
@@ -667,8 +678,8 @@ CFramebuffer* CHyprOpenGLImpl::blurMainFramebufferWithDamage(float a, wlr_box* p
     wlr_matrix_multiply(glMatrix, m_RenderData.projection, matrix);
 
     // get the config settings
-    static auto* const PBLURSIZE   = &g_pConfigManager->getConfigValuePtr("decoration:blur_size")->intValue;
-    static auto* const PBLURPASSES = &g_pConfigManager->getConfigValuePtr("decoration:blur_passes")->intValue;
+    static auto* const PBLURSIZE   = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_SIZE)->intValue;
+    static auto* const PBLURPASSES = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_PASSES)->intValue;
 
     // prep damage
     pixman_region32_t damage;
@@ -779,9 +790,9 @@ void CHyprOpenGLImpl::markBlurDirtyForMonitor(CMonitor* pMonitor) {
 }
 
 void CHyprOpenGLImpl::preRender(CMonitor* pMonitor) {
-    static auto* const PBLURNEWOPTIMIZE = &g_pConfigManager->getConfigValuePtr("decoration:blur_new_optimizations")->intValue;
-    static auto* const PBLURXRAY        = &g_pConfigManager->getConfigValuePtr("decoration:blur_xray")->intValue;
-    static auto* const PBLUR            = &g_pConfigManager->getConfigValuePtr("decoration:blur")->intValue;
+    static auto* const PBLURNEWOPTIMIZE = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_NEW_OPTIMIZATIONS)->intValue;
+    static auto* const PBLURXRAY        = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_XRAY)->intValue;
+    static auto* const PBLUR            = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR)->intValue;
 
     if (!*PBLURNEWOPTIMIZE || !m_mMonitorRenderResources[pMonitor].blurFBDirty || !*PBLUR)
         return;
@@ -846,6 +857,7 @@ void CHyprOpenGLImpl::preRender(CMonitor* pMonitor) {
 }
 
 void CHyprOpenGLImpl::preBlurForCurrentMonitor() {
+    GPU_PASS_SCOPE(GPU_PASS_PREBLUR);
 
     // make the fake dmg
     pixman_region32_t fakeDamage;
@@ -871,8 +883,8 @@ void CHyprOpenGLImpl::preBlurForCurrentMonitor() {
 }
 
 void CHyprOpenGLImpl::preWindowPass() {
-    static auto* const PBLURNEWOPTIMIZE = &g_pConfigManager->getConfigValuePtr("decoration:blur_new_optimizations")->intValue;
-    static auto* const PBLUR            = &g_pConfigManager->getConfigValuePtr("decoration:blur")->intValue;
+    static auto* const PBLURNEWOPTIMIZE = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_NEW_OPTIMIZATIONS)->intValue;
+    static auto* const PBLUR            = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR)->intValue;
 
     if (!m_RenderData.pCurrentMonData->blurFBDirty || !*PBLURNEWOPTIMIZE || !*PBLUR || !m_RenderData.pCurrentMonData->blurFBShouldRender)
         return;
@@ -884,10 +896,10 @@ void CHyprOpenGLImpl::preWindowPass() {
 void CHyprOpenGLImpl::renderTextureWithBlur(const CTexture& tex, wlr_box* pBox, float a, wlr_surface* pSurface, int round, bool blockBlurOptimization) {
     RASSERT(m_RenderData.pMonitor, "Tried to render texture with blur without begin()!");
 
-    static auto* const PBLURENABLED     = &g_pConfigManager->getConfigValuePtr("decoration:blur")->intValue;
-    static auto* const PNOBLUROVERSIZED = &g_pConfigManager->getConfigValuePtr("decoration:no_blur_on_oversized")->intValue;
-    static auto* const PBLURNEWOPTIMIZE = &g_pConfigManager->getConfigValuePtr("decoration:blur_new_optimizations")->intValue;
-    static auto* const PBLURXRAY        = &g_pConfigManager->getConfigValuePtr("decoration:blur_xray")->intValue;
+    static auto* const PBLURENABLED     = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR)->intValue;
+    static auto* const PNOBLUROVERSIZED = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_NO_BLUR_ON_OVERSIZED)->intValue;
+    static auto* const PBLURNEWOPTIMIZE = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_NEW_OPTIMIZATIONS)->intValue;
+    static auto* const PBLURXRAY        = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_XRAY)->intValue;
 
     // make a damage region for this window
     pixman_region32_t damage;
@@ -967,7 +979,7 @@ void CHyprOpenGLImpl::renderTextureWithBlur(const CTexture& tex, wlr_box* pBox,
     // stencil done. Render everything.
     wlr_box MONITORBOX = {0, 0, m_RenderData.pMonitor->vecTransformedSize.x, m_RenderData.pMonitor->vecTransformedSize.y};
     // render our great blurred FB
-    static auto* const PBLURIGNOREOPACITY = &g_pConfigManager->getConfigValuePtr("decoration:blur_ignore_opacity")->intValue;
+    static auto* const PBLURIGNOREOPACITY = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_IGNORE_OPACITY)->intValue;
     m_bEndFrame                           = true; // fix transformed
     renderTextureInternalWithDamage(POUTFB->m_cTex, &MONITORBOX, *PBLURIGNOREOPACITY ? 1.f : a, &damage, 0, false, false, false);
     m_bEndFrame = false;
@@ -1000,8 +1012,8 @@ void CHyprOpenGLImpl::renderBorder(wlr_box* box, const CGradientValueData& grad,
     if (!pixman_region32_not_empty(m_RenderData.pDamage) || (m_pCurrentWindow && m_pCurrentWindow->m_sAdditionalConfigData.forceNoBorder))
         return;
 
-    static auto* const PBORDERSIZE  = &g_pConfigManager->getConfigValuePtr("general:border_size")->intValue;
-    static auto* const PMULTISAMPLE = &g_pConfigManager->getConfigValuePtr("decoration:multisample_edges")->intValue;
+    static auto* const PBORDERSIZE  = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_BORDER_SIZE)->intValue;
+    static auto* const PMULTISAMPLE = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_MULTISAMPLE_EDGES)->intValue;
 
     if (*PBORDERSIZE < 1)
         return;
@@ -1124,7 +1136,7 @@ void CHyprOpenGLImpl::makeRawWindowSnapshot(CWindow* pWindow, CFramebuffer* pFra
     // will try to copy the bg to apply blur.
     // this isn't entirely correct, but like, oh well.
     // small todo: maybe make this correct? :P
-    const auto BLURVAL = g_pConfigManager->getInt("decoration:blur");
+    const auto BLURVAL = g_pConfigManager->getInt(CFG_DECORATION_BLUR);
     g_pConfigManager->setInt("decoration:blur", 0);
 
     // TODO: how can we make this the size of the window? setting it to window's size makes the entire screen render with the wrong res forever more. odd.
@@ -1185,7 +1197,7 @@ void CHyprOpenGLImpl::makeWindowSnapshot(CWindow* pWindow) {
     // will try to copy the bg to apply blur.
     // this isn't entirely correct, but like, oh well.
     // small todo: maybe make this correct? :P
-    const auto BLURVAL = g_pConfigManager->getInt("decoration:blur");
+    const auto BLURVAL = g_pConfigManager->getInt(CFG_DECORATION_BLUR);
     g_pConfigManager->setInt("decoration:blur", 0);
 
     glViewport(0, 0, m_RenderData.pMonitor->vecPixelSize.x, m_RenderData.pMonitor->vecPixelSize.y);
@@ -1282,7 +1294,7 @@ void CHyprOpenGLImpl::renderSnapshot(CWindow** pWindow) {
     RASSERT(m_RenderData.pMonitor, "Tried to render snapshot rect without begin()!");
     const auto         PWINDOW = *pWindow;
 
-    static auto* const PDIMAROUND = &g_pConfigManager->getConfigValuePtr("decoration:dim_around")->floatValue;
+    static auto* const PDIMAROUND = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DIM_AROUND)->floatValue;
 
     auto               it = m_mWindowFramebuffers.begin();
     for (; it != m_mWindowFramebuffers.end(); it++) {
@@ -1363,7 +1375,7 @@ void CHyprOpenGLImpl::renderRoundedShadow(wlr_box* box, int round, int range, fl
     if (!pixman_region32_not_empty(m_RenderData.pDamage))
         return;
 
-    static auto* const PSHADOWPOWER = &g_pConfigManager->getConfigValuePtr("decoration:shadow_render_power")->intValue;
+    static auto* const PSHADOWPOWER = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_SHADOW_RENDER_POWER)->intValue;
 
     const auto         SHADOWPOWER = std::clamp((int)*PSHADOWPOWER, 1, 4);
 
@@ -1477,7 +1489,7 @@ void CHyprOpenGLImpl::renderSplash(cairo_t* const CAIRO, cairo_surface_t* const
 void CHyprOpenGLImpl::createBGTextureForMonitor(CMonitor* pMonitor) {
     RASSERT(m_RenderData.pMonitor, "Tried to createBGTex without begin()!");
 
-    static auto* const PNOSPLASH = &g_pConfigManager->getConfigValuePtr("misc:disable_splash_rendering")->intValue;
+    static auto* const PNOSPLASH = &g_pConfigManager->getConfigValuePtr(CFG_MISC_DISABLE_SPLASH_RENDERING)->intValue;
 
     // release the last tex if exists
     const auto PTEX = &m_mMonitorBGTextures[pMonitor];
@@ -1562,7 +1574,7 @@ void CHyprOpenGLImpl::createBGTextureForMonitor(CMonitor* pMonitor) {
 void CHyprOpenGLImpl::clearWithTex() {
     RASSERT(m_RenderData.pMonitor, "Tried to render BGtex without begin()!");
 
-    static auto* const PRENDERTEX = &g_pConfigManager->getConfigValuePtr("misc:disable_hyprland_logo")->intValue;
+    static auto* const PRENDERTEX = &g_pConfigManager->getConfigValuePtr(CFG_MISC_DISABLE_HYPRLAND_LOGO)->intValue;
 
     if (!*PRENDERTEX) {
         auto TEXIT = m_mMonitorBGTextures.find(m_RenderData.pMonitor);
@@ -1589,8 +1601,33 @@ void CHyprOpenGLImpl::destroyMonitorResources(CMonitor* pMonitor) {
     g_pHyprOpenGL->m_mMonitorBGTextures[pMonitor].destroyTexture();
     g_pHyprOpenGL->m_mMonitorRenderResources.erase(pMonitor);
     g_pHyprOpenGL->m_mMonitorBGTextures.erase(pMonitor);
+    g_pHyprOpenGL->m_GPUTimers.destroyMonitor(pMonitor);
 
     Debug::log(LOG, "Monitor %s -> destroyed all render data", pMonitor->szName.c_str());
 
     wlr_output_rollback(pMonitor->output);
 }
+
+bool CHyprOpenGLImpl::blitFramebufferToBuffer(CFramebuffer* pSource, const wlr_box& box, wlr_buffer* pBuffer) {
+#ifndef GLES2
+    if (!pSource->isAllocated())
+        return false;
+
+    // wlroots imports the dmabuf and binds it as the framebuffer to draw into
+    if (!wlr_renderer_begin_with_buffer(g_pCompositor->m_sWLRRenderer, pBuffer)) {
+        Debug::log(ERR, "blitFramebufferToBuffer: couldn't render to buffer %lx", pBuffer);
+        return false;
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, pSource->m_iFb);
+    glBlitFramebuffer(box.x, box.y, box.x + box.width, box.y + box.height, 0, 0, box.width, box.height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+    // flushes, the client's reads wait for the blit through the dmabuf's implicit fences
+    wlr_renderer_end(g_pCompositor->m_sWLRRenderer);
+
+    return true;
+#else
+    return false;
+#endif
+}
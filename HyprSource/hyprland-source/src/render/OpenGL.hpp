@@ -12,6 +12,8 @@
 #include "Shader.hpp"
 #include "Texture.hpp"
 #include "Framebuffer.hpp"
+#include "GPUTimers.hpp"
+#include "AsyncReadback.hpp"
 
 class CHyprRenderer;
 
@@ -115,6 +117,9 @@ class CHyprOpenGLImpl {
 
     void                                       applyScreenShader(const std::string& path);
 
+    // copies box out of the framebuffer into a client's dmabuf on the GPU, for screencopy and toplevel export. not between begin() and end().
+    bool                                       blitFramebufferToBuffer(CFramebuffer*, const wlr_box&, wlr_buffer*);
+
     SCurrentRenderData                         m_RenderData;
 
     GLint                                      m_iCurrentOutputFb = 0;
@@ -131,6 +136,9 @@ class CHyprOpenGLImpl {
     std::unordered_map<CMonitor*, SMonitorRenderData> m_mMonitorRenderResources;
     std::unordered_map<CMonitor*, CTexture>           m_mMonitorBGTextures;
 
+    CGPUTimers                                        m_GPUTimers;
+    CAsyncReadback                                    m_AsyncReadback;
+
   private:
     std::list<GLuint> m_lBuffers;
     std::list<GLuint> m_lTextures;
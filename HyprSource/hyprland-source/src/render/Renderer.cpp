@@ -29,7 +29,7 @@ void renderSurface(struct wlr_surface* surface, int x, int y, void* data) {
 
     scaleBox(&windowBox, RDATA->pMonitor->scale);
 
-    static auto* const PROUNDING = &g_pConfigManager->getConfigValuePtr("decoration:rounding")->intValue;
+    static auto* const PROUNDING = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ROUNDING)->intValue;
 
     float              rounding = RDATA->dontRound ? 0 : RDATA->rounding == -1 ? *PROUNDING : RDATA->rounding;
     rounding *= RDATA->pMonitor->scale;
@@ -227,6 +227,8 @@ void CHyprRenderer::renderWorkspaceWithFullscreenWindow(CMonitor* pMonitor, CWor
 }
 
 void CHyprRenderer::renderWindow(CWindow* pWindow, CMonitor* pMonitor, timespec* time, bool decorate, eRenderPassMode mode, bool ignorePosition, bool ignoreAllGeometry) {
+    GPU_PASS_SCOPE(GPU_PASS_WINDOWS);
+
     if (pWindow->isHidden())
         return;
 
@@ -238,8 +240,8 @@ void CHyprRenderer::renderWindow(CWindow* pWindow, CMonitor* pMonitor, timespec*
 
     const auto         PWORKSPACE         = g_pCompositor->getWorkspaceByID(pWindow->m_iWorkspaceID);
     const auto         REALPOS            = pWindow->m_vRealPosition.vec() + (pWindow->m_bPinned ? Vector2D{} : PWORKSPACE->m_vRenderOffset.vec());
-    static auto* const PNOFLOATINGBORDERS = &g_pConfigManager->getConfigValuePtr("general:no_border_on_floating")->intValue;
-    static auto* const PDIMAROUND         = &g_pConfigManager->getConfigValuePtr("decoration:dim_around")->floatValue;
+    static auto* const PNOFLOATINGBORDERS = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_NO_BORDER_ON_FLOATING)->intValue;
+    static auto* const PDIMAROUND         = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DIM_AROUND)->floatValue;
 
     SRenderData        renderdata = {pMonitor, time, REALPOS.x, REALPOS.y};
     if (ignorePosition) {
@@ -309,14 +311,19 @@ void CHyprRenderer::renderWindow(CWindow* pWindow, CMonitor* pMonitor, timespec*
 
     // render window decorations first, if not fullscreen full
     if (mode == RENDER_PASS_ALL || mode == RENDER_PASS_MAIN) {
-        if (!pWindow->m_bIsFullscreen || PWORKSPACE->m_efFullscreenMode != FULLSCREEN_FULL)
+        if (!pWindow->m_bIsFullscreen || PWORKSPACE->m_efFullscreenMode != FULLSCREEN_FULL) {
+            GPU_PASS_SCOPE(GPU_PASS_DECORATIONS);
+
             for (auto& wd : pWindow->m_dWindowDecorations)
                 wd->draw(pMonitor, renderdata.alpha * renderdata.fadeAlpha, offset);
+        }
 
         wlr_surface_for_each_surface(pWindow->m_pWLSurface.wlr(), renderSurface, &renderdata);
 
         if (renderdata.decorate && pWindow->m_sSpecialRenderData.border) {
-            static auto* const PROUNDING = &g_pConfigManager->getConfigValuePtr("decoration:rounding")->intValue;
+            GPU_PASS_SCOPE(GPU_PASS_DECORATIONS);
+
+            static auto* const PROUNDING = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ROUNDING)->intValue;
 
             float              rounding = renderdata.dontRound ? 0 : renderdata.rounding == -1 ? *PROUNDING : renderdata.rounding;
             rounding *= pMonitor->scale;
@@ -363,6 +370,8 @@ void CHyprRenderer::renderWindow(CWindow* pWindow, CMonitor* pMonitor, timespec*
 }
 
 void CHyprRenderer::renderLayer(SLayerSurface* pLayer, CMonitor* pMonitor, timespec* time) {
+    GPU_PASS_SCOPE(GPU_PASS_LAYERS);
+
     if (pLayer->fadingOut) {
         g_pHyprOpenGL->renderSnapshot(&pLayer);
         return;
@@ -412,8 +421,10 @@ void CHyprRenderer::renderSessionLockSurface(SSessionLockSurface* pSurface, CMon
 }
 
 void CHyprRenderer::renderAllClientsForMonitor(const int& ID, timespec* time) {
+    TRACE_SCOPE("render", "renderAllClientsForMonitor");
+
     const auto         PMONITOR    = g_pCompositor->getMonitorFromID(ID);
-    static auto* const PDIMSPECIAL = &g_pConfigManager->getConfigValuePtr("decoration:dim_special")->floatValue;
+    static auto* const PDIMSPECIAL = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DIM_SPECIAL)->floatValue;
 
     if (!PMONITOR)
         return;
@@ -743,15 +754,17 @@ bool CHyprRenderer::attemptDirectScanout(CMonitor* pMonitor) {
 }
 
 void CHyprRenderer::renderMonitor(CMonitor* pMonitor) {
+    TRACE_SCOPE("render", "renderMonitor");
+
     static std::chrono::high_resolution_clock::time_point startRender        = std::chrono::high_resolution_clock::now();
     static std::chrono::high_resolution_clock::time_point startRenderOverlay = std::chrono::high_resolution_clock::now();
     static std::chrono::high_resolution_clock::time_point endRenderOverlay   = std::chrono::high_resolution_clock::now();
 
-    static auto* const                                    PDEBUGOVERLAY       = &g_pConfigManager->getConfigValuePtr("debug:overlay")->intValue;
-    static auto* const                                    PDAMAGETRACKINGMODE = &g_pConfigManager->getConfigValuePtr("debug:damage_tracking")->intValue;
-    static auto* const                                    PDAMAGEBLINK        = &g_pConfigManager->getConfigValuePtr("debug:damage_blink")->intValue;
-    static auto* const                                    PNODIRECTSCANOUT    = &g_pConfigManager->getConfigValuePtr("misc:no_direct_scanout")->intValue;
-    static auto* const                                    PVFR                = &g_pConfigManager->getConfigValuePtr("misc:vfr")->intValue;
+    static auto* const                                    PDEBUGOVERLAY       = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_OVERLAY)->intValue;
+    static auto* const                                    PDAMAGETRACKINGMODE = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_DAMAGE_TRACKING)->intValue;
+    static auto* const                                    PDAMAGEBLINK        = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_DAMAGE_BLINK)->intValue;
+    static auto* const                                    PNODIRECTSCANOUT    = &g_pConfigManager->getConfigValuePtr(CFG_MISC_NO_DIRECT_SCANOUT)->intValue;
+    static auto* const                                    PVFR                = &g_pConfigManager->getConfigValuePtr(CFG_MISC_VFR)->intValue;
 
     static int                                            damageBlinkCleanup = 0; // because double-buffered
 
@@ -854,13 +867,13 @@ void CHyprRenderer::renderMonitor(CMonitor* pMonitor) {
 
         pixman_region32_copy(&g_pHyprOpenGL->m_rOriginalDamageRegion, &damage);
     } else {
-        static auto* const PBLURENABLED = &g_pConfigManager->getConfigValuePtr("decoration:blur")->intValue;
+        static auto* const PBLURENABLED = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR)->intValue;
 
         // if we use blur we need to expand the damage for proper blurring
         if (*PBLURENABLED == 1) {
             // TODO: can this be optimized?
-            static auto* const PBLURSIZE   = &g_pConfigManager->getConfigValuePtr("decoration:blur_size")->intValue;
-            static auto* const PBLURPASSES = &g_pConfigManager->getConfigValuePtr("decoration:blur_passes")->intValue;
+            static auto* const PBLURSIZE   = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_SIZE)->intValue;
+            static auto* const PBLURPASSES = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_BLUR_PASSES)->intValue;
             const auto         BLURRADIUS =
                 *PBLURPASSES > 10 ? pow(2, 15) : std::clamp(*PBLURSIZE, (int64_t)1, (int64_t)40) * pow(2, *PBLURPASSES); // is this 2^pass? I don't know but it works... I think.
 
@@ -894,6 +907,8 @@ void CHyprRenderer::renderMonitor(CMonitor* pMonitor) {
 
         renderAllClientsForMonitor(pMonitor->ID, &now);
 
+        g_pHyprOpenGL->m_GPUTimers.beginPass(pMonitor, GPU_PASS_OVERLAYS);
+
         if (pMonitor == g_pCompositor->m_pLastMonitor) {
             g_pHyprNotificationOverlay->draw(pMonitor);
             g_pHyprError->draw();
@@ -920,6 +935,8 @@ void CHyprRenderer::renderMonitor(CMonitor* pMonitor) {
             wlr_output_render_software_cursors(pMonitor->output, NULL);
             wlr_renderer_end(g_pCompositor->m_sWLRRenderer);
         }
+
+        g_pHyprOpenGL->m_GPUTimers.endPass(pMonitor, GPU_PASS_OVERLAYS);
     }
 
     g_pHyprOpenGL->end();
@@ -939,6 +956,12 @@ void CHyprRenderer::renderMonitor(CMonitor* pMonitor) {
 
     wlr_output_set_damage(pMonitor->output, &frameDamage);
 
+    int        damageRects = 0;
+    const auto DAMAGERECTS = pixman_region32_rectangles(&frameDamage, &damageRects);
+    double     damageArea  = 0;
+    for (int i = 0; i < damageRects; ++i)
+        damageArea += (double)(DAMAGERECTS[i].x2 - DAMAGERECTS[i].x1) * (DAMAGERECTS[i].y2 - DAMAGERECTS[i].y1);
+
     if (!pMonitor->mirrors.empty())
         g_pHyprRenderer->damageMirrorsWith(pMonitor, &frameDamage);
 
@@ -957,6 +980,8 @@ void CHyprRenderer::renderMonitor(CMonitor* pMonitor) {
         return;
     }
 
+    pMonitor->frameStats.onCommit(pMonitor->output->commit_seq);
+
     g_pProtocolManager->m_pScreencopyProtocolManager->onRenderEnd(pMonitor);
     pixman_region32_fini(&damage);
 
@@ -971,6 +996,8 @@ void CHyprRenderer::renderMonitor(CMonitor* pMonitor) {
     const float µs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - startRender).count() / 1000.f;
     g_pDebugOverlay->renderData(pMonitor, µs);
 
+    pMonitor->frameStats.onRender(µs / 1000.f, damageArea * 100.0 / std::max(1.0, pMonitor->vecTransformedSize.x * pMonitor->vecTransformedSize.y));
+
     if (*PDEBUGOVERLAY == 1) {
         if (pMonitor == g_pCompositor->m_vMonitors.front().get()) {
             const float µsNoOverlay = µs - std::chrono::duration_cast<std::chrono::nanoseconds>(endRenderOverlay - startRenderOverlay).count() / 1000.f;
@@ -1216,6 +1243,8 @@ void CHyprRenderer::arrangeLayersForMonitor(const int& monitor) {
     if (!PMONITOR)
         return;
 
+    HyprCtl::markStateChanged(SNAPSHOT_LAYERS | SNAPSHOT_MONITORS);
+
     // Reset the reserved
     PMONITOR->vecReservedBottomRight = Vector2D();
     PMONITOR->vecReservedTopLeft     = Vector2D();
@@ -1291,7 +1320,7 @@ void CHyprRenderer::damageSurface(wlr_surface* pSurface, double x, double y) {
 
     pixman_region32_fini(&damageBoxForEach);
 
-    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr("debug:log_damage")->intValue;
+    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_LOG_DAMAGE)->intValue;
 
     if (*PLOGDAMAGE)
         Debug::log(LOG, "Damage: Surface (extents): xy: %d, %d wh: %d, %d", damageBox.extents.x1, damageBox.extents.y1, damageBox.extents.x2 - damageBox.extents.x1,
@@ -1311,20 +1340,20 @@ void CHyprRenderer::damageWindow(CWindow* pWindow) {
         m->addDamage(&fixedDamageBox);
     }
 
-    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr("debug:log_damage")->intValue;
+    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_LOG_DAMAGE)->intValue;
 
     if (*PLOGDAMAGE)
         Debug::log(LOG, "Damage: Window (%s): xy: %d, %d wh: %d, %d", pWindow->m_szTitle.c_str(), damageBox.x, damageBox.y, damageBox.width, damageBox.height);
 }
 
 void CHyprRenderer::damageMonitor(CMonitor* pMonitor) {
-    if (g_pCompositor->m_bUnsafeState || pMonitor->isMirror())
+    if (g_pCompositor->m_bUnsafeState || pMonitor->isMirror() || g_pCompositor->deferMonitorDamage(pMonitor))
         return;
 
     wlr_box damageBox = {0, 0, INT16_MAX, INT16_MAX};
     pMonitor->addDamage(&damageBox);
 
-    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr("debug:log_damage")->intValue;
+    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_LOG_DAMAGE)->intValue;
 
     if (*PLOGDAMAGE)
         Debug::log(LOG, "Damage: Monitor %s", pMonitor->szName.c_str());
@@ -1343,7 +1372,7 @@ void CHyprRenderer::damageBox(wlr_box* pBox) {
         m->addDamage(&damageBox);
     }
 
-    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr("debug:log_damage")->intValue;
+    static auto* const PLOGDAMAGE = &g_pConfigManager->getConfigValuePtr(CFG_DEBUG_LOG_DAMAGE)->intValue;
 
     if (*PLOGDAMAGE)
         Debug::log(LOG, "Damage: Box: xy: %d, %d wh: %d, %d", pBox->x, pBox->y, pBox->width, pBox->height);
@@ -1407,6 +1436,8 @@ bool CHyprRenderer::applyMonitorRule(CMonitor* pMonitor, SMonitorRule* pMonitorR
 
     Debug::log(LOG, "Applying monitor rule for %s", pMonitor->szName.c_str());
 
+    HyprCtl::markStateChanged(SNAPSHOT_MONITORS | SNAPSHOT_WORKSPACES | SNAPSHOT_LAYERS);
+
     // if it's disabled, disable and ignore
     if (pMonitorRule->disabled) {
 
@@ -1734,8 +1765,8 @@ bool CHyprRenderer::applyMonitorRule(CMonitor* pMonitor, SMonitorRule* pMonitorR
 }
 
 void CHyprRenderer::ensureCursorRenderingMode() {
-    static auto* const PCURSORTIMEOUT = &g_pConfigManager->getConfigValuePtr("general:cursor_inactive_timeout")->intValue;
-    static auto* const PHIDEONTOUCH   = &g_pConfigManager->getConfigValuePtr("misc:hide_cursor_on_touch")->intValue;
+    static auto* const PCURSORTIMEOUT = &g_pConfigManager->getConfigValuePtr(CFG_GENERAL_CURSOR_INACTIVE_TIMEOUT)->intValue;
+    static auto* const PHIDEONTOUCH   = &g_pConfigManager->getConfigValuePtr(CFG_MISC_HIDE_CURSOR_ON_TOUCH)->intValue;
 
     const auto         PASSEDCURSORSECONDS = g_pInputManager->m_tmrLastCursorMovement.getSeconds();
 
@@ -11,7 +11,7 @@ CHyprDropShadowDecoration::~CHyprDropShadowDecoration() {
 }
 
 SWindowDecorationExtents CHyprDropShadowDecoration::getWindowDecorationExtents() {
-    static auto* const PSHADOWS = &g_pConfigManager->getConfigValuePtr("decoration:drop_shadow")->intValue;
+    static auto* const PSHADOWS = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DROP_SHADOW)->intValue;
 
     if (*PSHADOWS != 1)
         return {{}, {}};
@@ -24,7 +24,7 @@ eDecorationType CHyprDropShadowDecoration::getDecorationType() {
 }
 
 void CHyprDropShadowDecoration::damageEntire() {
-    static auto* const PSHADOWS = &g_pConfigManager->getConfigValuePtr("decoration:drop_shadow")->intValue;
+    static auto* const PSHADOWS = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DROP_SHADOW)->intValue;
 
     if (*PSHADOWS != 1)
         return; // disabled
@@ -63,12 +63,12 @@ void CHyprDropShadowDecoration::draw(CMonitor* pMonitor, float a, const Vector2D
     if (m_pWindow->m_sAdditionalConfigData.forceNoShadow)
         return;
 
-    static auto* const PSHADOWS            = &g_pConfigManager->getConfigValuePtr("decoration:drop_shadow")->intValue;
-    static auto* const PSHADOWSIZE         = &g_pConfigManager->getConfigValuePtr("decoration:shadow_range")->intValue;
-    static auto* const PROUNDING           = &g_pConfigManager->getConfigValuePtr("decoration:rounding")->intValue;
-    static auto* const PSHADOWIGNOREWINDOW = &g_pConfigManager->getConfigValuePtr("decoration:shadow_ignore_window")->intValue;
-    static auto* const PSHADOWSCALE        = &g_pConfigManager->getConfigValuePtr("decoration:shadow_scale")->floatValue;
-    static auto* const PSHADOWOFFSET       = &g_pConfigManager->getConfigValuePtr("decoration:shadow_offset")->vecValue;
+    static auto* const PSHADOWS            = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_DROP_SHADOW)->intValue;
+    static auto* const PSHADOWSIZE         = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_SHADOW_RANGE)->intValue;
+    static auto* const PROUNDING           = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_ROUNDING)->intValue;
+    static auto* const PSHADOWIGNOREWINDOW = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_SHADOW_IGNORE_WINDOW)->intValue;
+    static auto* const PSHADOWSCALE        = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_SHADOW_SCALE)->floatValue;
+    static auto* const PSHADOWOFFSET       = &g_pConfigManager->getConfigValuePtr(CFG_DECORATION_SHADOW_OFFSET)->vecValue;
 
     if (*PSHADOWS != 1)
         return; // disabled